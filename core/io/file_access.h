@@ -35,6 +35,7 @@
 #include "core/object/ref_counted.h"
 #include "core/os/memory.h"
 #include "core/string/ustring.h"
+#include "core/templates/span.h"
 #include "core/typedefs.h"
 #include "core/variant/type_info.h"
 
@@ -117,6 +118,7 @@ protected:
 	virtual void _set_access_type(AccessType p_access);
 
 	static inline FileCloseFailNotify close_fail_notify = nullptr;
+	static inline thread_local uint64_t thread_bytes_read = 0; // Bytes read from storage by the calling thread, updated by the platform backends.
 
 #ifndef DISABLE_DEPRECATED
 	static Ref<FileAccess> _open_encrypted_bind_compat_98918(const String &p_path, ModeFlags p_mode_flags, const Vector<uint8_t> &p_key);
@@ -163,6 +165,7 @@ private:
 
 public:
 	static void set_file_close_fail_notify_callback(FileCloseFailNotify p_cbk) { close_fail_notify = p_cbk; }
+	static uint64_t get_thread_bytes_read() { return thread_bytes_read; }
 
 	virtual bool is_open() const = 0; ///< true when file is open
 
@@ -190,6 +193,7 @@ public:
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const = 0; ///< get an array of bytes, needs to be overwritten by children.
 	Vector<uint8_t> get_buffer(int64_t p_length) const;
+	virtual Span<uint8_t> get_mapped_data() const { return Span<uint8_t>(); } ///< read-only view of the whole file, if the backend can provide one without copying. Empty otherwise. Valid until the file is closed, or for files inside a mounted pack, until PackedData::clear(). Safe to call from several threads at once.
 	virtual String get_line() const;
 	virtual String get_token() const;
 	virtual Vector<String> get_csv_line(const String &p_delim = ",") const;
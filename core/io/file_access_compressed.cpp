@@ -30,7 +30,9 @@
 
 #include "file_access_compressed.h"
 
+#include "core/io/marshalls.h"
 #include "core/math/math_funcs_binary.h"
+#include "core/object/worker_thread_pool.h"
 
 void FileAccessCompressed::configure(const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
 	magic = p_magic.ascii().get_data();
@@ -113,51 +115,58 @@ Error FileAccessCompressed::open_internal(const String &p_path, int p_mode_flags
 	return OK;
 }
 
-void FileAccessCompressed::_close() {
-	if (f.is_null()) {
-		return;
-	}
+Vector<uint8_t> FileAccessCompressed::compress_buffer(const uint8_t *p_data, uint64_t p_size, const String &p_magic, Compression::Mode p_mode, uint32_t p_block_size) {
+	ERR_FAIL_COND_V(p_block_size == 0, Vector<uint8_t>());
+	ERR_FAIL_COND_V_MSG(p_size > UINT32_MAX, Vector<uint8_t>(), "Compressed files can't be larger than 4 GiB.");
 
-	if (writing) {
-		//save block table and all compressed blocks
+	const CharString mgc = (p_magic + "    ").substr(0, 4).ascii();
+	const uint32_t bc = (p_size / p_block_size) + 1;
+	const uint32_t last_block_size = p_size % p_block_size;
 
-		CharString mgc = magic.utf8();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //write header 4
-		f->store_32(cmode); //write compression mode 4
-		f->store_32(block_size); //write block size 4
-		f->store_32(uint32_t(write_max)); //max amount of data written 4
-		uint32_t bc = (write_max / block_size) + 1;
+	Vector<uint8_t> data;
+	data.resize(16 + bc * 4);
+	uint8_t *header = data.ptrw();
+	memcpy(header, mgc.get_data(), 4); //write header 4
+	encode_uint32(p_mode, header + 4); //write compression mode 4
+	encode_uint32(p_block_size, header + 8); //write block size 4
+	encode_uint32(uint32_t(p_size), header + 12); //max amount of data written 4
 
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(0); //compressed sizes, will update later
-		}
+	// Temporary buffer for compressed data blocks.
+	LocalVector<uint8_t> temp_cblock;
+	temp_cblock.resize(Compression::get_max_compressed_buffer_size(bc == 1 ? last_block_size : p_block_size, p_mode));
+	uint8_t *temp_cblock_ptr = temp_cblock.ptr();
 
-		uint32_t last_block_size = write_max % block_size;
+	// Compress and append the blocks, filling in the block size table.
+	for (uint32_t i = 0; i < bc; i++) {
+		uint32_t bl = i == (bc - 1) ? last_block_size : p_block_size;
 
-		// Temporary buffer for compressed data blocks.
-		LocalVector<uint8_t> temp_cblock;
-		temp_cblock.resize(Compression::get_max_compressed_buffer_size(bc == 1 ? last_block_size : block_size, cmode));
-		uint8_t *temp_cblock_ptr = temp_cblock.ptr();
+		const int64_t compressed_size = Compression::compress(temp_cblock_ptr, &p_data[i * p_block_size], bl, p_mode);
+		ERR_FAIL_COND_V(compressed_size < 0, Vector<uint8_t>());
 
-		// Compress and store the blocks.
-		LocalVector<uint32_t> block_sizes;
-		for (uint32_t i = 0; i < bc; i++) {
-			uint32_t bl = i == (bc - 1) ? last_block_size : block_size;
-			uint8_t *bp = &write_ptr[i * block_size];
+		const int64_t ofs = data.size();
+		data.resize(ofs + compressed_size);
+		memcpy(data.ptrw() + ofs, temp_cblock_ptr, compressed_size);
+		encode_uint32(compressed_size, data.ptrw() + 16 + i * 4);
+	}
 
-			const int64_t compressed_size = Compression::compress(temp_cblock_ptr, bp, bl, cmode);
-			ERR_FAIL_COND_MSG(compressed_size < 0, "FileAccessCompressed: Error compressing data.");
+	// Magic at the end too.
+	const int64_t ofs = data.size();
+	data.resize(ofs + 4);
+	memcpy(data.ptrw() + ofs, mgc.get_data(), 4);
 
-			f->store_buffer(temp_cblock_ptr, (uint64_t)compressed_size);
-			block_sizes.push_back(compressed_size);
-		}
+	return data;
+}
 
-		f->seek(16); //ok write block sizes
-		for (uint32_t i = 0; i < bc; i++) {
-			f->store_32(block_sizes[i]);
-		}
-		f->seek_end();
-		f->store_buffer((const uint8_t *)mgc.get_data(), mgc.length()); //magic at the end too
+void FileAccessCompressed::_close() {
+	if (f.is_null()) {
+		return;
+	}
+
+	if (writing) {
+		//save block table and all compressed blocks
+		const Vector<uint8_t> data = compress_buffer(write_ptr, write_max, magic, cmode, block_size);
+		ERR_FAIL_COND_MSG(data.is_empty(), "FileAccessCompressed: Error compressing data.");
+		f->store_buffer(data);
 	} else {
 		comp_buffer.clear();
 		read_blocks.clear();
@@ -292,6 +301,18 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 			return dst_idx;
 		}
 
+		// Decompress runs of whole blocks straight into the destination. Reads from pool threads,
+		// such as resource loads, stay sequential: waiting there for a group could deadlock.
+		const uint32_t whole_blocks = MIN((p_length - dst_idx) / block_size, uint64_t(read_block_count - 1 - read_block));
+		if (whole_blocks >= PARALLEL_READ_MIN_BLOCKS && WorkerThreadPool::get_singleton() && WorkerThreadPool::get_singleton()->get_thread_index() == -1) {
+			ERR_FAIL_COND_V_MSG(!_read_blocks_parallel(p_dst + dst_idx, whole_blocks), -1, "Compressed file is corrupt.");
+			dst_idx += uint64_t(whole_blocks) * block_size;
+			read_block += whole_blocks - 1;
+			read_block_size = block_size;
+			read_pos = block_size;
+			continue;
+		}
+
 		// Read the next block of compressed data.
 		f->get_buffer(comp_buffer.ptrw(), read_blocks[read_block].csize);
 		const int64_t ret = Compression::decompress(buffer.ptrw(), read_blocks.size() == 1 ? read_total : block_size, comp_buffer.ptr(), read_blocks[read_block].csize, cmode);
@@ -303,6 +324,45 @@ uint64_t FileAccessCompressed::get_buffer(uint8_t *p_dst, uint64_t p_length) con
 	return p_length;
 }
 
+void FileAccessCompressed::_decompress_block_task(void *p_data, uint32_t p_index) {
+	ParallelReadData *rd = (ParallelReadData *)p_data;
+	const ReadBlock &rb = rd->blocks[p_index];
+	const int64_t ret = Compression::decompress(rd->dst + uint64_t(p_index) * rd->block_size, rd->block_size, rd->src + (rb.offset - rd->blocks[0].offset), rb.csize, rd->mode);
+	// Only whole blocks are read in parallel, anything shorter is corrupt.
+	if (ret != rd->block_size) {
+		rd->failed.set();
+	}
+}
+
+bool FileAccessCompressed::_read_blocks_parallel(uint8_t *p_dst, uint32_t p_block_count) const {
+	// Blocks are stored contiguously, so their compressed data can be fetched with a single read.
+	const ReadBlock &first = read_blocks[read_block];
+	const ReadBlock &last = read_blocks[read_block + p_block_count - 1];
+	LocalVector<uint8_t> src;
+	src.resize(last.offset + last.csize - first.offset);
+	f->seek(first.offset);
+	if (f->get_buffer(src.ptr(), src.size()) != src.size()) {
+		return false;
+	}
+
+	ParallelReadData rd;
+	rd.src = src.ptr();
+	rd.dst = p_dst;
+	rd.blocks = &first;
+	rd.block_size = block_size;
+	rd.mode = cmode;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&FileAccessCompressed::_decompress_block_task, &rd, p_block_count, -1, true, "FileAccessCompressedRead");
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	if (rd.failed.is_set()) {
+		return false;
+	}
+
+	// Keep the last block around, as if it had been read sequentially.
+	memcpy(buffer.ptrw(), p_dst + uint64_t(p_block_count - 1) * block_size, block_size);
+	return true;
+}
+
 Error FileAccessCompressed::get_error() const {
 	return read_eof ? ERR_FILE_EOF : OK;
 }
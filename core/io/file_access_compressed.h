@@ -32,6 +32,7 @@
 
 #include "core/io/compression.h"
 #include "core/io/file_access.h"
+#include "core/templates/safe_refcount.h"
 
 class FileAccessCompressed : public FileAccess {
 	GDSOFTCLASS(FileAccessCompressed, FileAccess);
@@ -63,6 +64,21 @@ class FileAccessCompressed : public FileAccess {
 	mutable Vector<uint8_t> buffer;
 	Ref<FileAccess> f;
 
+	// Reads spanning at least this many whole blocks decompress them in parallel.
+	static constexpr uint32_t PARALLEL_READ_MIN_BLOCKS = 16;
+
+	struct ParallelReadData {
+		const uint8_t *src = nullptr;
+		uint8_t *dst = nullptr;
+		const ReadBlock *blocks = nullptr;
+		uint32_t block_size = 0;
+		Compression::Mode mode = Compression::MODE_ZSTD;
+		SafeFlag failed;
+	};
+
+	static void _decompress_block_task(void *p_data, uint32_t p_index);
+	bool _read_blocks_parallel(uint8_t *p_dst, uint32_t p_block_count) const;
+
 	void _close();
 
 public:
@@ -70,6 +86,8 @@ public:
 
 	Error open_after_magic(Ref<FileAccess> p_base);
 
+	static Vector<uint8_t> compress_buffer(const uint8_t *p_data, uint64_t p_size, const String &p_magic, Compression::Mode p_mode = Compression::MODE_ZSTD, uint32_t p_block_size = 4096);
+
 	virtual Error open_internal(const String &p_path, int p_mode_flags) override; ///< open a file
 	virtual bool is_open() const override; ///< true when file is open
 
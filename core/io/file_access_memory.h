@@ -56,6 +56,7 @@ public:
 	virtual bool eof_reached() const override; ///< reading passed EOF
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override; ///< get an array of bytes
+	virtual Span<uint8_t> get_mapped_data() const override { return Span<uint8_t>(data, length); }
 
 	virtual Error get_error() const override; ///< get last error
 
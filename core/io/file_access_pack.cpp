@@ -30,8 +30,10 @@
 
 #include "file_access_pack.h"
 
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_patched.h"
+#include "core/io/marshalls.h"
 #include "core/object/script_language.h"
 #include "core/os/os.h"
 #include "core/version.h"
@@ -46,16 +48,17 @@ Error PackedData::add_pack(const String &p_path, bool p_replace_files, uint64_t
 	return ERR_FILE_UNRECOGNIZED;
 }
 
-void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta, const String &p_salt) {
+void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted, bool p_bundle, bool p_delta, const String &p_salt, bool p_compressed) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
 
-	bool exists = files.has(pmd5);
+	bool exists = files.has(pmd5) || _find_indexed(simplified_path, pmd5) != -1;
 
 	PackedFile pf;
 	pf.encrypted = p_encrypted;
 	pf.bundle = p_bundle;
 	pf.delta = p_delta;
+	pf.compressed = p_compressed;
 	pf.pack = p_pkg_path;
 	pf.salt = p_salt;
 	pf.offset = p_ofs;
@@ -99,9 +102,227 @@ void PackedData::add_path(const String &p_pkg_path, const String &p_path, uint64
 	}
 }
 
+static _FORCE_INLINE_ int _compare_index_paths(const char *p_a, uint32_t p_a_length, const char *p_b, uint32_t p_b_length) {
+	int cmp = memcmp(p_a, p_b, MIN(p_a_length, p_b_length));
+	if (cmp != 0) {
+		return cmp;
+	}
+	return p_a_length < p_b_length ? -1 : (p_a_length > p_b_length ? 1 : 0);
+}
+
+// Only paths that are already simplified can be compared directly with lookups.
+static bool _is_index_path_valid(const char *p_path, uint32_t p_length) {
+	if (p_length == 0) {
+		return false;
+	}
+	uint32_t segment_start = 0;
+	for (uint32_t i = 0; i <= p_length; i++) {
+		if (i < p_length && p_path[i] != '/') {
+			if (p_path[i] == '\\' || p_path[i] == ':') {
+				return false;
+			}
+			continue;
+		}
+		uint32_t segment_length = i - segment_start;
+		if (segment_length == 0) {
+			return false; // Leading, trailing or duplicate slash.
+		}
+		if (p_path[segment_start] == '.' && (segment_length == 1 || (segment_length == 2 && p_path[segment_start + 1] == '.'))) {
+			return false;
+		}
+		segment_start = i + 1;
+	}
+	return true;
+}
+
+const char *PackedData::PackIndex::get_path(uint32_t p_entry, uint32_t &r_length) const {
+	const uint8_t *entry = data + entries[p_entry];
+	const char *path = (const char *)(entry + 4);
+	r_length = strnlen(path, decode_uint32(entry)); // Stored length includes the padding.
+	return path;
+}
+
+uint32_t PackedData::PackIndex::lower_bound(const char *p_path, uint32_t p_length) const {
+	uint32_t lo = 0;
+	uint32_t hi = entries.size();
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+		uint32_t length;
+		const char *path = get_path(mid, length);
+		if (_compare_index_paths(path, length, p_path, p_length) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+int64_t PackedData::PackIndex::find(const CharString &p_path) const {
+	uint32_t i = lower_bound(p_path.get_data(), p_path.length());
+	if (i == entries.size()) {
+		return -1;
+	}
+	uint32_t length;
+	const char *path = get_path(i, length);
+	if (_compare_index_paths(path, length, p_path.get_data(), p_path.length()) != 0) {
+		return -1;
+	}
+	return i;
+}
+
+bool PackedData::PackIndex::has_directory(const CharString &p_dir) const {
+	if (p_dir.length() == 0) {
+		return true;
+	}
+	LocalVector<char> prefix;
+	prefix.resize(p_dir.length() + 1);
+	memcpy(prefix.ptr(), p_dir.get_data(), p_dir.length());
+	prefix[p_dir.length()] = '/';
+
+	uint32_t i = lower_bound(prefix.ptr(), prefix.size());
+	if (i == entries.size()) {
+		return false;
+	}
+	uint32_t length;
+	const char *path = get_path(i, length);
+	return length > prefix.size() && memcmp(path, prefix.ptr(), prefix.size()) == 0;
+}
+
+void PackedData::PackIndex::get_file(uint32_t p_entry, PackedFile &r_file) const {
+	const uint8_t *entry = data + entries[p_entry];
+	entry += 4 + decode_uint32(entry);
+
+	uint32_t flags = decode_uint32(entry + 32);
+	r_file.pack = pack;
+	r_file.offset = file_base + decode_uint64(entry);
+	r_file.size = decode_uint64(entry + 8);
+	memcpy(r_file.md5, entry + 16, 16);
+	r_file.src = src;
+	r_file.encrypted = flags & PACK_FILE_ENCRYPTED;
+	r_file.bundle = false;
+	r_file.delta = false;
+	r_file.compressed = flags & PACK_FILE_COMPRESSED;
+}
+
+bool PackedData::add_pack_index(const String &p_pkg_path, Ref<FileAccess> p_file, uint32_t p_file_count, uint64_t p_file_base, PackSource *p_src) {
+	// Later packs can override or remove files, so only the first one is indexed.
+	if (index || !files.is_empty() || !delta_patches.is_empty() || p_file_count == 0) {
+		return false;
+	}
+
+	struct EntryComparator {
+		const PackIndex *index = nullptr;
+
+		_FORCE_INLINE_ bool operator()(uint32_t p_a, uint32_t p_b) const {
+			uint32_t a_length = strnlen((const char *)(index->data + p_a + 4), decode_uint32(index->data + p_a));
+			uint32_t b_length = strnlen((const char *)(index->data + p_b + 4), decode_uint32(index->data + p_b));
+			return _compare_index_paths((const char *)(index->data + p_a + 4), a_length, (const char *)(index->data + p_b + 4), b_length) < 0;
+		}
+	};
+
+	const uint64_t directory_pos = p_file->get_position();
+
+	PackIndex *pi = memnew(PackIndex);
+	pi->pack = p_pkg_path;
+	pi->src = p_src;
+	pi->file_base = p_file_base;
+
+	// Bytes of the directory available in `data`. Without a mapping the directory is read as
+	// its entries are parsed, since in some pack versions file data follows it directly.
+	uint64_t available = 0;
+	uint64_t readable = 0;
+	Span<uint8_t> mapping = get_pack_mapping(p_pkg_path);
+	if (mapping.size() > directory_pos) {
+		pi->data = mapping.ptr() + directory_pos;
+		available = mapping.size() - directory_pos;
+	} else {
+		readable = MIN(p_file->get_length() - directory_pos, (uint64_t)UINT32_MAX);
+	}
+
+	auto ensure_available = [&](uint64_t p_size) -> bool {
+		if (p_size <= available) {
+			return true;
+		}
+		if (p_size > readable) {
+			return false;
+		}
+		// Grow geometrically, so the read never goes further than twice the directory size.
+		const uint64_t size = MIN(MAX(p_size, available * 2 + 4096), readable);
+		pi->directory.resize(size);
+		available += p_file->get_buffer(pi->directory.ptrw() + available, size - available);
+		pi->data = pi->directory.ptr();
+		return p_size <= available;
+	};
+
+	bool valid = true;
+	bool sorted = true;
+	pi->entries.resize(p_file_count);
+	uint64_t ofs = 0;
+	for (uint32_t i = 0; i < p_file_count; i++) {
+		if (ofs > UINT32_MAX || !ensure_available(ofs + 4)) {
+			valid = false;
+			break;
+		}
+		const uint32_t sl = decode_uint32(pi->data + ofs);
+		const uint64_t entry_size = 4 + (uint64_t)sl + 8 + 8 + 16 + 4;
+		if (!ensure_available(ofs + entry_size)) {
+			valid = false;
+			break;
+		}
+
+		// Removals and delta patches apply to other packs, those use the regular file list.
+		const uint32_t flags = decode_uint32(pi->data + ofs + entry_size - 4);
+		pi->entries[i] = ofs;
+		uint32_t length;
+		const char *path = pi->get_path(i, length);
+		if ((flags & (PACK_FILE_REMOVAL | PACK_FILE_DELTA)) || !_is_index_path_valid(path, length)) {
+			valid = false;
+			break;
+		}
+		if (sorted && i > 0) {
+			uint32_t prev_length;
+			const char *prev_path = pi->get_path(i - 1, prev_length);
+			sorted = _compare_index_paths(prev_path, prev_length, path, length) < 0;
+		}
+		ofs += entry_size;
+	}
+
+	if (valid && !pi->directory.is_empty()) {
+		pi->directory.resize(ofs); // Drop any file data read past the directory.
+		pi->data = pi->directory.ptr();
+	}
+
+	if (valid && !sorted) {
+		SortArray<uint32_t, EntryComparator> sorter;
+		sorter.compare.index = pi;
+		sorter.sort(pi->entries.ptr(), pi->entries.size());
+
+		// Duplicate paths depend on the order they were stored in.
+		for (uint32_t i = 1; i < pi->entries.size() && valid; i++) {
+			uint32_t prev_length, length;
+			const char *prev_path = pi->get_path(i - 1, prev_length);
+			const char *path = pi->get_path(i, length);
+			valid = _compare_index_paths(prev_path, prev_length, path, length) != 0;
+		}
+	}
+
+	if (!valid) {
+		memdelete(pi);
+		p_file->seek(directory_pos);
+		return false;
+	}
+
+	index = pi;
+	return true;
+}
+
 void PackedData::remove_path(const String &p_path) {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
+	if (_find_indexed(simplified_path, pmd5) != -1) {
+		index->removed.insert(pmd5);
+	}
 	if (!files.has(pmd5)) {
 		return;
 	}
@@ -132,15 +353,27 @@ void PackedData::add_pack_source(PackSource *p_source) {
 	}
 }
 
-uint8_t *PackedData::get_file_hash(const String &p_path) {
+Vector<uint8_t> PackedData::get_file_hash(const String &p_path) const {
 	String simplified_path = p_path.simplify_path().trim_prefix("res://");
 	PathMD5 pmd5(simplified_path.md5_buffer());
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
-	if (!E) {
-		return nullptr;
+	const uint8_t *md5 = nullptr;
+	HashMap<PathMD5, PackedFile, PathMD5>::ConstIterator E = files.find(pmd5);
+	if (E) {
+		md5 = E->value.md5;
+	} else {
+		int64_t entry = _find_indexed(simplified_path, pmd5);
+		if (entry == -1) {
+			return Vector<uint8_t>();
+		}
+		const uint8_t *data = index->data + index->entries[entry];
+		md5 = data + 4 + decode_uint32(data) + 16;
 	}
 
-	return E->value.md5;
+	// Copied, indexed hashes point into the read-only pack mapping.
+	Vector<uint8_t> hash;
+	hash.resize(16);
+	memcpy(hash.ptrw(), md5, 16);
+	return hash;
 }
 
 Vector<PackedData::PackedFile> PackedData::get_delta_patches(const String &p_path) const {
@@ -168,9 +401,103 @@ bool PackedData::has_delta_patches(const String &p_path) const {
 HashSet<String> PackedData::get_file_paths() const {
 	HashSet<String> file_paths;
 	_get_file_paths(root, root->name, file_paths);
+	if (index) {
+		for (uint32_t i = 0; i < index->entries.size(); i++) {
+			uint32_t length;
+			const char *path = index->get_path(i, length);
+			String file_path = String::utf8(path, length);
+			if (index->removed.is_empty() || !index->removed.has(PathMD5(file_path.md5_buffer()))) {
+				file_paths.insert(file_path);
+			}
+		}
+	}
 	return file_paths;
 }
 
+PackedData::PackedDir *PackedData::_find_packed_dir(const String &p_dir) const {
+	PackedDir *pd = root;
+	if (p_dir.is_empty()) {
+		return pd;
+	}
+	for (const String &name : p_dir.split("/")) {
+		HashMap<String, PackedDir *>::ConstIterator E = pd->subdirs.find(name);
+		if (!E) {
+			return nullptr;
+		}
+		pd = E->value;
+	}
+	return pd;
+}
+
+bool PackedData::_has_directory(const String &p_dir) const {
+	return _find_packed_dir(p_dir) != nullptr || (index && index->has_directory(p_dir.utf8()));
+}
+
+void PackedData::_get_directory_contents(const String &p_dir, List<String> &r_dirs, List<String> &r_files) const {
+	HashSet<String> dirs;
+	PackedDir *pd = _find_packed_dir(p_dir);
+	if (pd) {
+		for (const KeyValue<String, PackedDir *> &E : pd->subdirs) {
+			dirs.insert(E.key);
+			r_dirs.push_back(E.key);
+		}
+		for (const String &E : pd->files) {
+			r_files.push_back(E);
+		}
+	}
+
+	if (!index) {
+		return;
+	}
+
+	CharString dir = p_dir.utf8();
+	LocalVector<char> prefix;
+	prefix.resize(dir.length());
+	memcpy(prefix.ptr(), dir.get_data(), dir.length());
+	if (!prefix.is_empty()) {
+		prefix.push_back('/');
+	}
+	const uint32_t prefix_length = prefix.size();
+
+	uint32_t i = index->lower_bound(prefix.ptr(), prefix_length);
+	while (i < index->entries.size()) {
+		uint32_t length;
+		const char *path = index->get_path(i, length);
+		if (length <= prefix_length || memcmp(path, prefix.ptr(), prefix_length) != 0) {
+			break;
+		}
+
+		const char *name = path + prefix_length;
+		const uint32_t name_length = length - prefix_length;
+		const char *slash = (const char *)memchr(name, '/', name_length);
+		if (!slash) {
+			if (index->removed.is_empty() || !index->removed.has(PathMD5(String::utf8(path, length).md5_buffer()))) {
+				String file = String::utf8(name, name_length);
+				if (!pd || !pd->files.has(file)) { // Files overridden by a later pack are already listed.
+					r_files.push_back(file);
+				}
+			}
+			i++;
+			continue;
+		}
+
+		String subdir = String::utf8(name, slash - name);
+		if (!dirs.has(subdir)) {
+			dirs.insert(subdir);
+			r_dirs.push_back(subdir);
+		}
+
+		// Skip the rest of the subdirectory, '0' sorts right after '/'.
+		prefix.resize(prefix_length);
+		for (const char *c = name; c < slash; c++) {
+			prefix.push_back(*c);
+		}
+		prefix.push_back('0');
+		i = index->lower_bound(prefix.ptr(), prefix.size());
+		prefix.resize(prefix_length);
+	}
+}
+
 void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const {
 	for (const String &E : p_dir->files) {
 		r_paths.insert(p_parent_dir.path_join(E));
@@ -181,9 +508,37 @@ void PackedData::_get_file_paths(PackedDir *p_dir, const String &p_parent_dir, H
 	}
 }
 
+Span<uint8_t> PackedData::get_pack_mapping(const String &p_pack) {
+	MutexLock lock(pack_mappings_mutex);
+
+	HashMap<String, Ref<FileAccess>>::Iterator E = pack_mappings.find(p_pack);
+	if (!E) {
+		// Cache failures too, so unmappable packs are only opened once.
+		E = pack_mappings.insert(p_pack, FileAccess::open(p_pack, FileAccess::READ));
+	}
+	if (E->value.is_null()) {
+		return Span<uint8_t>();
+	}
+	return E->value->get_mapped_data();
+}
+
+int64_t PackedData::_get_uncompressed_size(const String &p_path) {
+	// The directory holds the compressed size, the actual one is in the compressed file's header.
+	Ref<FileAccess> f = try_open_path(p_path);
+	return f.is_valid() ? (int64_t)f->get_length() : -1;
+}
+
 void PackedData::clear() {
 	files.clear();
 	delta_patches.clear();
+	if (index) {
+		memdelete(index);
+		index = nullptr;
+	}
+	{
+		MutexLock lock(pack_mappings_mutex);
+		pack_mappings.clear();
+	}
 	_free_packed_dirs(root);
 	root = memnew(PackedDir);
 }
@@ -210,6 +565,9 @@ PackedData::~PackedData() {
 	for (int i = 0; i < sources.size(); i++) {
 		memdelete(sources[i]);
 	}
+	if (index) {
+		memdelete(index);
+	}
 	_free_packed_dirs(root);
 }
 
@@ -347,6 +705,8 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		Error err = fae->open_and_parse(f, key, FileAccessEncrypted::MODE_READ, false);
 		ERR_FAIL_COND_V_MSG(err, false, "Can't open encrypted pack directory.");
 		f = fae;
+	} else if (!sparse_bundle && PackedData::get_singleton()->add_pack_index(p_path, f, file_count, file_base, this)) {
+		return true;
 	}
 
 	for (int i = 0; i < file_count; i++) {
@@ -366,7 +726,7 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 		if (flags & PACK_FILE_REMOVAL) { // The file was removed.
 			PackedData::get_singleton()->remove_path(path);
 		} else {
-			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, (flags & PACK_FILE_DELTA), salt);
+			PackedData::get_singleton()->add_path(p_path, path, file_base + ofs, size, md5, this, p_replace_files, (flags & PACK_FILE_ENCRYPTED), sparse_bundle, (flags & PACK_FILE_DELTA), salt, (flags & PACK_FILE_COMPRESSED));
 		}
 	}
 
@@ -376,6 +736,18 @@ bool PackedSourcePCK::try_open_pack(const String &p_path, bool p_replace_files,
 Ref<FileAccess> PackedSourcePCK::get_file(const String &p_path, PackedData::PackedFile *p_file, const Vector<uint8_t> &p_decryption_key) {
 	Ref<FileAccess> file(memnew(FileAccessPack(p_path, *p_file, p_decryption_key)));
 
+	if (p_file->compressed) {
+		uint8_t magic[4] = {};
+		file->get_buffer(magic, 4);
+		ERR_FAIL_COND_V_MSG(memcmp(magic, PACK_FILE_COMPRESSED_MAGIC, 4) != 0, Ref<FileAccess>(), vformat(R"(Compressed pack-referenced file "%s" from pack "%s" is corrupted.)", p_path, p_file->pack));
+
+		Ref<FileAccessCompressed> file_compressed;
+		file_compressed.instantiate();
+		Error err = file_compressed->open_after_magic(file);
+		ERR_FAIL_COND_V(err != OK, Ref<FileAccess>());
+		file = file_compressed;
+	}
+
 	if (PackedData::get_singleton()->has_delta_patches(p_path)) {
 		Ref<FileAccessPatched> file_patched;
 		file_patched.instantiate();
@@ -493,6 +865,21 @@ uint64_t FileAccessPack::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 	return to_read;
 }
 
+Span<uint8_t> FileAccessPack::get_mapped_data() const {
+	ERR_FAIL_COND_V_MSG(f.is_null(), Span<uint8_t>(), "File must be opened before use.");
+
+	if (pf.encrypted) {
+		return Span<uint8_t>();
+	}
+
+	// Regular packs share one mapping of the whole pack, sparse bundles map each file on its own.
+	Span<uint8_t> mapping = pf.bundle ? f->get_mapped_data() : PackedData::get_singleton()->get_pack_mapping(pf.pack);
+	if (mapping.size() < off + pf.size) {
+		return Span<uint8_t>();
+	}
+	return Span<uint8_t>(mapping.ptr() + off, pf.size);
+}
+
 void FileAccessPack::set_big_endian(bool p_big_endian) {
 	ERR_FAIL_COND_MSG(f.is_null(), "File must be opened before use.");
 
@@ -589,13 +976,7 @@ Error DirAccessPack::list_dir_begin() {
 	list_dirs.clear();
 	list_files.clear();
 
-	for (const KeyValue<String, PackedData::PackedDir *> &E : current->subdirs) {
-		list_dirs.push_back(E.key);
-	}
-
-	for (const String &E : current->files) {
-		list_files.push_back(E);
-	}
+	PackedData::get_singleton()->_get_directory_contents(current, list_dirs, list_files);
 
 	return OK;
 }
@@ -637,12 +1018,16 @@ String DirAccessPack::get_drive(int p_drive) {
 	return "";
 }
 
-PackedData::PackedDir *DirAccessPack::_find_dir(const String &p_dir) {
+bool DirAccessPack::_find_dir(const String &p_dir, String &r_dir) const {
 	String nd = p_dir.replace_char('\\', '/');
 
 	// Special handling since simplify_path() will forbid it
 	if (p_dir == "..") {
-		return current->parent;
+		if (current.is_empty()) {
+			return false;
+		}
+		r_dir = current.get_base_dir();
+		return true;
 	}
 
 	bool absolute = false;
@@ -664,36 +1049,28 @@ PackedData::PackedDir *DirAccessPack::_find_dir(const String &p_dir) {
 
 	Vector<String> paths = nd.split("/");
 
-	PackedData::PackedDir *pd;
-
-	if (absolute) {
-		pd = PackedData::get_singleton()->root;
-	} else {
-		pd = current;
-	}
+	String pd = absolute ? String() : current;
 
 	for (int i = 0; i < paths.size(); i++) {
 		const String &p = paths[i];
 		if (p == ".") {
 			continue;
 		} else if (p == "..") {
-			if (pd->parent) {
-				pd = pd->parent;
-			}
-		} else if (pd->subdirs.has(p)) {
-			pd = pd->subdirs[p];
-
+			pd = pd.get_base_dir();
+		} else if (PackedData::get_singleton()->_has_directory(pd.path_join(p))) {
+			pd = pd.path_join(p);
 		} else {
-			return nullptr;
+			return false;
 		}
 	}
 
-	return pd;
+	r_dir = pd;
+	return true;
 }
 
 Error DirAccessPack::change_dir(String p_dir) {
-	PackedData::PackedDir *pd = _find_dir(p_dir);
-	if (pd) {
+	String pd;
+	if (_find_dir(p_dir, pd)) {
 		current = pd;
 		return OK;
 	} else {
@@ -702,27 +1079,20 @@ Error DirAccessPack::change_dir(String p_dir) {
 }
 
 String DirAccessPack::get_current_dir(bool p_include_drive) const {
-	PackedData::PackedDir *pd = current;
-	String p = current->name;
-
-	while (pd->parent) {
-		pd = pd->parent;
-		p = pd->name.path_join(p);
-	}
-
-	return "res://" + p;
+	return "res://" + current;
 }
 
 bool DirAccessPack::file_exists(String p_file) {
-	PackedData::PackedDir *pd = _find_dir(p_file.get_base_dir());
-	if (!pd) {
+	String pd;
+	if (!_find_dir(p_file.get_base_dir(), pd)) {
 		return false;
 	}
-	return pd->files.has(p_file.get_file());
+	return PackedData::get_singleton()->has_path(pd.path_join(p_file.get_file()));
 }
 
 bool DirAccessPack::dir_exists(String p_dir) {
-	return _find_dir(p_dir) != nullptr;
+	String pd;
+	return _find_dir(p_dir, pd);
 }
 
 Error DirAccessPack::make_dir(String p_dir) {
@@ -744,7 +1114,3 @@ uint64_t DirAccessPack::get_space_left() {
 String DirAccessPack::get_filesystem_type() const {
 	return "PCK";
 }
-
-DirAccessPack::DirAccessPack() {
-	current = PackedData::get_singleton()->root;
-}
@@ -33,9 +33,11 @@
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_uid.h"
+#include "core/os/mutex.h"
 #include "core/string/print_string.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 
 // Godot's packed file magic header ("GDPC" in ASCII).
 #define PACK_HEADER_MAGIC 0x43504447
@@ -57,14 +59,19 @@ enum PackFileFlags {
 	PACK_FILE_ENCRYPTED = 1 << 0,
 	PACK_FILE_REMOVAL = 1 << 1,
 	PACK_FILE_DELTA = 1 << 2,
+	PACK_FILE_COMPRESSED = 1 << 3,
 };
 
+// Magic of files stored with PACK_FILE_COMPRESSED, in FileAccessCompressed format.
+#define PACK_FILE_COMPRESSED_MAGIC "GCPF"
+
 class PackSource;
 
 class PackedData {
 	friend class FileAccessPack;
 	friend class DirAccessPack;
 	friend class PackSource;
+	friend class TestPackedDataInternalsAccessor;
 
 public:
 	struct PackedFile {
@@ -76,6 +83,7 @@ public:
 		bool encrypted;
 		bool bundle;
 		bool delta;
+		bool compressed = false;
 		String salt;
 	};
 
@@ -107,36 +115,73 @@ private:
 		}
 	};
 
+	// Directory of the first mounted pack, kept in its serialized form instead of creating
+	// an entry per file. Lookups and directory listings binary search its path order.
+	struct PackIndex {
+		String pack;
+		PackSource *src = nullptr;
+		uint64_t file_base = 0;
+		Vector<uint8_t> directory; // Copy of the directory, only used when the pack can't be mapped.
+		const uint8_t *data = nullptr;
+		LocalVector<uint32_t> entries; // Offsets of the directory entries in `data`, sorted by path.
+		HashSet<PathMD5, PathMD5> removed;
+
+		_FORCE_INLINE_ const char *get_path(uint32_t p_entry, uint32_t &r_length) const;
+		uint32_t lower_bound(const char *p_path, uint32_t p_length) const;
+		int64_t find(const CharString &p_path) const;
+		bool has_directory(const CharString &p_dir) const;
+		void get_file(uint32_t p_entry, PackedFile &r_file) const;
+	};
+
 	HashMap<PathMD5, PackedFile, PathMD5> files;
+	PackIndex *index = nullptr;
 	HashMap<PathMD5, Vector<PackedFile>, PathMD5> delta_patches;
 
 	Vector<PackSource *> sources;
 
 	PackedDir *root = nullptr;
 
+	// Pack files kept open so that their contents can be served from a single mapping.
+	Mutex pack_mappings_mutex;
+	HashMap<String, Ref<FileAccess>> pack_mappings;
+
 	static inline PackedData *singleton = nullptr;
 	bool disabled = false;
 
 	void _free_packed_dirs(PackedDir *p_dir);
 	void _get_file_paths(PackedDir *p_dir, const String &p_parent_dir, HashSet<String> &r_paths) const;
 
-	_FORCE_INLINE_ PathMD5 _get_simplified_path(const String &p_path) {
+	PackedDir *_find_packed_dir(const String &p_dir) const;
+	bool _has_directory(const String &p_dir) const;
+	void _get_directory_contents(const String &p_dir, List<String> &r_dirs, List<String> &r_files) const;
+	int64_t _get_uncompressed_size(const String &p_path);
+
+	_FORCE_INLINE_ String _simplify_path(const String &p_path) const {
 		String simplified_path = p_path;
 		if (simplified_path.begins_with("uid://")) {
 			simplified_path = ResourceUID::uid_to_path(simplified_path);
 		}
-		simplified_path = simplified_path.simplify_path().trim_prefix("res://");
-		return PathMD5(simplified_path.md5_buffer());
+		return simplified_path.simplify_path().trim_prefix("res://");
+	}
+
+	// Returns the index entry of a file, or -1 if it isn't (or no longer is) in the index.
+	_FORCE_INLINE_ int64_t _find_indexed(const String &p_simplified_path, const PathMD5 &p_md5) const {
+		if (!index || index->removed.has(p_md5)) {
+			return -1;
+		}
+		return index->find(p_simplified_path.utf8());
 	}
 
 public:
 	void add_pack_source(PackSource *p_source);
-	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false, const String &p_salt = String()); // for PackSource
+	void add_path(const String &p_pkg_path, const String &p_path, uint64_t p_ofs, uint64_t p_size, const uint8_t *p_md5, PackSource *p_src, bool p_replace_files, bool p_encrypted = false, bool p_bundle = false, bool p_delta = false, const String &p_salt = String(), bool p_compressed = false); // for PackSource
+	bool add_pack_index(const String &p_pkg_path, Ref<FileAccess> p_file, uint32_t p_file_count, uint64_t p_file_base, PackSource *p_src); // for PackSource
 	void remove_path(const String &p_path);
-	uint8_t *get_file_hash(const String &p_path);
+	Vector<uint8_t> get_file_hash(const String &p_path) const;
 	Vector<PackedFile> get_delta_patches(const String &p_path) const;
 	bool has_delta_patches(const String &p_path) const;
 	HashSet<String> get_file_paths() const;
+	Span<uint8_t> get_pack_mapping(const String &p_pack);
 
 	void set_disabled(bool p_disabled) { disabled = p_disabled; }
 	_FORCE_INLINE_ bool is_disabled() const { return disabled; }
@@ -215,6 +260,7 @@ public:
 	virtual bool eof_reached() const override;
 
 	virtual uint64_t get_buffer(uint8_t *p_dst, uint64_t p_length) const override;
+	virtual Span<uint8_t> get_mapped_data() const override;
 
 	virtual void set_big_endian(bool p_big_endian) override;
 
@@ -232,27 +278,51 @@ public:
 };
 
 int64_t PackedData::get_size(const String &p_path) {
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(_get_simplified_path(p_path));
+	String simplified_path = _simplify_path(p_path);
+	PathMD5 pmd5(simplified_path.md5_buffer());
+	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
 	if (!E) {
-		return -1; // File not found.
+		int64_t entry = _find_indexed(simplified_path, pmd5);
+		if (entry == -1) {
+			return -1; // File not found.
+		}
+		PackedFile pf;
+		index->get_file(entry, pf);
+		if (pf.compressed) {
+			return _get_uncompressed_size(p_path);
+		}
+		return pf.size;
 	}
 	if (E->value.offset == 0) {
 		return -1; // File was erased.
 	}
+	if (E->value.compressed) {
+		return _get_uncompressed_size(p_path);
+	}
 	return E->value.size;
 }
 
 Ref<FileAccess> PackedData::try_open_path(const String &p_path, const Vector<uint8_t> &p_decryption_key) {
-	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(_get_simplified_path(p_path));
+	String simplified_path = _simplify_path(p_path);
+	PathMD5 pmd5(simplified_path.md5_buffer());
+	HashMap<PathMD5, PackedFile, PathMD5>::Iterator E = files.find(pmd5);
 	if (!E) {
-		return nullptr; // Not found.
+		int64_t entry = _find_indexed(simplified_path, pmd5);
+		if (entry == -1) {
+			return nullptr; // Not found.
+		}
+		PackedFile pf;
+		index->get_file(entry, pf);
+		return pf.src->get_file(p_path, &pf, p_decryption_key);
 	}
 
 	return E->value.src->get_file(p_path, &E->value, p_decryption_key);
 }
 
 bool PackedData::has_path(const String &p_path) {
-	return files.has(_get_simplified_path(p_path));
+	String simplified_path = _simplify_path(p_path);
+	PathMD5 pmd5(simplified_path.md5_buffer());
+	return files.has(pmd5) || _find_indexed(simplified_path, pmd5) != -1;
 }
 
 bool PackedData::has_directory(const String &p_path) {
@@ -266,13 +336,13 @@ bool PackedData::has_directory(const String &p_path) {
 
 class DirAccessPack : public DirAccess {
 	GDSOFTCLASS(DirAccessPack, DirAccess);
-	PackedData::PackedDir *current;
+	String current; // Relative to "res://", empty for the root.
 
 	List<String> list_dirs;
 	List<String> list_files;
 	bool cdir = false;
 
-	PackedData::PackedDir *_find_dir(const String &p_dir);
+	bool _find_dir(const String &p_dir, String &r_dir) const;
 
 public:
 	virtual Error list_dir_begin() override;
@@ -302,8 +372,6 @@ public:
 	virtual Error create_link(String p_source, String p_target) override { return FAILED; }
 
 	virtual String get_filesystem_type() const override;
-
-	DirAccessPack();
 };
 
 Ref<DirAccess> PackedData::try_open_directory(const String &p_path) {
@@ -37,6 +37,7 @@
 #include "core/io/resource_loader.h"
 #include "core/math/math_funcs.h"
 #include "core/object/class_db.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/hash_map.h"
 #include "core/variant/dictionary.h"
 
@@ -518,6 +519,41 @@ int Image::get_mipmap_count() const {
 	}
 }
 
+// Large images are processed in bands of rows on the WorkerThreadPool, each band
+// computed exactly as it would be on a single thread.
+static constexpr uint32_t IMAGE_PARALLEL_MIN_PIXELS = 64 * 1024; // Per task.
+static constexpr uint32_t IMAGE_COMPRESS_MIN_BLOCKS = 1024; // Per task, blocks are much slower to encode than pixels to convert.
+
+template <typename F>
+struct ImageRowBands {
+	const F &func;
+	uint32_t height = 0;
+	uint32_t rows_per_band = 0;
+
+	static void process_band(void *p_userdata, uint32_t p_index) {
+		const ImageRowBands *bands = (const ImageRowBands *)p_userdata;
+		const uint32_t begin = p_index * bands->rows_per_band;
+		bands->func(begin, MIN(begin + bands->rows_per_band, bands->height));
+	}
+};
+
+// Calls `p_func(begin, end)` for bands of rows covering `[0, p_height)`.
+template <typename F>
+static void _process_rows(uint32_t p_width, uint32_t p_height, const F &p_func, uint32_t p_min_per_band = IMAGE_PARALLEL_MIN_PIXELS) {
+	const uint32_t rows_per_band = MAX(1u, p_min_per_band / MAX(p_width, 1u));
+	const uint32_t band_count = (p_height + rows_per_band - 1) / rows_per_band;
+	// Images are also processed from pool threads, e.g. while importing. Waiting there
+	// for a group could deadlock once every thread is waiting, so those run inline.
+	if (band_count <= 1 || !WorkerThreadPool::get_singleton() || WorkerThreadPool::get_singleton()->get_thread_index() != -1) {
+		p_func(0, p_height);
+		return;
+	}
+
+	ImageRowBands<F> bands = { p_func, p_height, rows_per_band };
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&ImageRowBands<F>::process_band, &bands, band_count, -1, true, "Process image rows");
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+}
+
 // Using template generates perfectly optimized code due to constant expression reduction and unused variable removal present in all compilers.
 template <uint32_t read_bytes, bool read_alpha, uint32_t write_bytes, bool write_alpha, bool read_gray, bool write_gray>
 static void _convert(int p_width, int p_height, const uint8_t *p_src, uint8_t *p_dst) {
@@ -581,6 +617,15 @@ static void _convert_fast(int p_width, int p_height, const T *p_src, T *p_dst) {
 	}
 }
 
+template <typename T>
+static void _convert_parallel(void (*p_func)(int, int, const T *, T *), int p_width, int p_height, const T *p_src, T *p_dst, uint32_t p_src_pixel_size, uint32_t p_dst_pixel_size) {
+	_process_rows(p_width, p_height, [&](uint32_t p_begin, uint32_t p_end) {
+		const T *src = (const T *)((const uint8_t *)p_src + uint64_t(p_begin) * p_width * p_src_pixel_size);
+		T *dst = (T *)((uint8_t *)p_dst + uint64_t(p_begin) * p_width * p_dst_pixel_size);
+		p_func(p_width, p_end - p_begin, src, dst);
+	});
+}
+
 static bool _are_formats_compatible(Image::Format p_format0, Image::Format p_format1) {
 	if (p_format0 <= Image::FORMAT_RGBA8 && p_format1 <= Image::FORMAT_RGBA8) {
 		return true;
@@ -618,12 +663,14 @@ void Image::convert(Format p_new_format) {
 			uint8_t *dst_mip_ptr = new_img.ptrw() + dst_mip_ofs;
 			const uint8_t *src_mip_ptr = ptr() + src_mip_ofs;
 
-			for (int y = 0; y < h; y++) {
-				for (int x = 0; x < w; x++) {
-					uint32_t mip_ofs = y * w + x;
-					new_img._set_color_at_ofs(dst_mip_ptr, mip_ofs, _get_color_at_ofs(src_mip_ptr, mip_ofs));
+			_process_rows(w, h, [&](uint32_t p_begin, uint32_t p_end) {
+				for (uint32_t y = p_begin; y < p_end; y++) {
+					for (int x = 0; x < w; x++) {
+						uint32_t mip_ofs = y * w + x;
+						new_img._set_color_at_ofs(dst_mip_ptr, mip_ofs, _get_color_at_ofs(src_mip_ptr, mip_ofs));
+					}
 				}
-			}
+			});
 		}
 
 		_copy_internals_from(new_img);
@@ -634,6 +681,8 @@ void Image::convert(Format p_new_format) {
 	Image new_img(width, height, mipmaps, p_new_format);
 
 	const int conversion_type = format | p_new_format << 8;
+	const uint32_t src_pixel_size = get_format_pixel_size(format);
+	const uint32_t dst_pixel_size = get_format_pixel_size(p_new_format);
 
 	for (int mip = 0; mip < mipmap_count; mip++) {
 		int64_t mip_offset = 0;
@@ -647,238 +696,238 @@ void Image::convert(Format p_new_format) {
 
 		switch (conversion_type) {
 			case FORMAT_L8 | (FORMAT_LA8 << 8):
-				_convert<1, false, 1, true, true, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 1, true, true, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_L8 | (FORMAT_R8 << 8):
-				_convert<1, false, 1, false, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 1, false, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_L8 | (FORMAT_RG8 << 8):
-				_convert<1, false, 2, false, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 2, false, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_L8 | (FORMAT_RGB8 << 8):
-				_convert<1, false, 3, false, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 3, false, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_L8 | (FORMAT_RGBA8 << 8):
-				_convert<1, false, 3, true, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 3, true, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_LA8 | (FORMAT_L8 << 8):
-				_convert<1, true, 1, false, true, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, true, 1, false, true, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_LA8 | (FORMAT_R8 << 8):
-				_convert<1, true, 1, false, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, true, 1, false, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_LA8 | (FORMAT_RG8 << 8):
-				_convert<1, true, 2, false, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, true, 2, false, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_LA8 | (FORMAT_RGB8 << 8):
-				_convert<1, true, 3, false, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, true, 3, false, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_LA8 | (FORMAT_RGBA8 << 8):
-				_convert<1, true, 3, true, true, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, true, 3, true, true, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R8 | (FORMAT_L8 << 8):
-				_convert<1, false, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 1, false, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R8 | (FORMAT_LA8 << 8):
-				_convert<1, false, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 1, true, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R8 | (FORMAT_RG8 << 8):
-				_convert<1, false, 2, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 2, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R8 | (FORMAT_RGB8 << 8):
-				_convert<1, false, 3, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 3, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R8 | (FORMAT_RGBA8 << 8):
-				_convert<1, false, 3, true, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<1, false, 3, true, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG8 | (FORMAT_L8 << 8):
-				_convert<2, false, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<2, false, 1, false, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG8 | (FORMAT_LA8 << 8):
-				_convert<2, false, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<2, false, 1, true, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG8 | (FORMAT_R8 << 8):
-				_convert<2, false, 1, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<2, false, 1, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG8 | (FORMAT_RGB8 << 8):
-				_convert<2, false, 3, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<2, false, 3, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG8 | (FORMAT_RGBA8 << 8):
-				_convert<2, false, 3, true, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<2, false, 3, true, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB8 | (FORMAT_L8 << 8):
-				_convert<3, false, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, false, 1, false, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB8 | (FORMAT_LA8 << 8):
-				_convert<3, false, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, false, 1, true, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB8 | (FORMAT_R8 << 8):
-				_convert<3, false, 1, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, false, 1, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB8 | (FORMAT_RG8 << 8):
-				_convert<3, false, 2, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, false, 2, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB8 | (FORMAT_RGBA8 << 8):
-				_convert<3, false, 3, true, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, false, 3, true, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA8 | (FORMAT_L8 << 8):
-				_convert<3, true, 1, false, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, true, 1, false, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA8 | (FORMAT_LA8 << 8):
-				_convert<3, true, 1, true, false, true>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, true, 1, true, false, true>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA8 | (FORMAT_R8 << 8):
-				_convert<3, true, 1, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, true, 1, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA8 | (FORMAT_RG8 << 8):
-				_convert<3, true, 2, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, true, 2, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA8 | (FORMAT_RGB8 << 8):
-				_convert<3, true, 3, false, false, false>(mip_width, mip_height, rptr, wptr);
+				_convert_parallel(_convert<3, true, 3, false, false, false>, mip_width, mip_height, rptr, wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RH | (FORMAT_RGH << 8):
-				_convert_fast<uint16_t, 1, 2, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 2, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RH | (FORMAT_RGBH << 8):
-				_convert_fast<uint16_t, 1, 3, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 3, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RH | (FORMAT_RGBAH << 8):
-				_convert_fast<uint16_t, 1, 4, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 4, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGH | (FORMAT_RH << 8):
-				_convert_fast<uint16_t, 2, 1, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 1, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGH | (FORMAT_RGBH << 8):
-				_convert_fast<uint16_t, 2, 3, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 3, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGH | (FORMAT_RGBAH << 8):
-				_convert_fast<uint16_t, 2, 4, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 4, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBH | (FORMAT_RH << 8):
-				_convert_fast<uint16_t, 3, 1, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 1, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBH | (FORMAT_RGH << 8):
-				_convert_fast<uint16_t, 3, 2, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 2, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBH | (FORMAT_RGBAH << 8):
-				_convert_fast<uint16_t, 3, 4, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 4, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBAH | (FORMAT_RH << 8):
-				_convert_fast<uint16_t, 4, 1, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 1, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBAH | (FORMAT_RGH << 8):
-				_convert_fast<uint16_t, 4, 2, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 2, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBAH | (FORMAT_RGBH << 8):
-				_convert_fast<uint16_t, 4, 3, 0x0000, 0x3C00>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 3, 0x0000, 0x3C00>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RF | (FORMAT_RGF << 8):
-				_convert_fast<uint32_t, 1, 2, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 1, 2, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RF | (FORMAT_RGBF << 8):
-				_convert_fast<uint32_t, 1, 3, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 1, 3, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RF | (FORMAT_RGBAF << 8):
-				_convert_fast<uint32_t, 1, 4, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 1, 4, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGF | (FORMAT_RF << 8):
-				_convert_fast<uint32_t, 2, 1, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 2, 1, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGF | (FORMAT_RGBF << 8):
-				_convert_fast<uint32_t, 2, 3, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 2, 3, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGF | (FORMAT_RGBAF << 8):
-				_convert_fast<uint32_t, 2, 4, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 2, 4, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBF | (FORMAT_RF << 8):
-				_convert_fast<uint32_t, 3, 1, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 3, 1, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBF | (FORMAT_RGF << 8):
-				_convert_fast<uint32_t, 3, 2, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 3, 2, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBF | (FORMAT_RGBAF << 8):
-				_convert_fast<uint32_t, 3, 4, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 3, 4, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBAF | (FORMAT_RF << 8):
-				_convert_fast<uint32_t, 4, 1, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 4, 1, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBAF | (FORMAT_RGF << 8):
-				_convert_fast<uint32_t, 4, 2, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 4, 2, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBAF | (FORMAT_RGBF << 8):
-				_convert_fast<uint32_t, 4, 3, 0x00000000, 0x3F800000>(mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr);
+				_convert_parallel(_convert_fast<uint32_t, 4, 3, 0x00000000, 0x3F800000>, mip_width, mip_height, (const uint32_t *)rptr, (uint32_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R16 | (FORMAT_RG16 << 8):
-				_convert_fast<uint16_t, 1, 2, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 2, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R16 | (FORMAT_RGB16 << 8):
-				_convert_fast<uint16_t, 1, 3, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 3, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R16 | (FORMAT_RGBA16 << 8):
-				_convert_fast<uint16_t, 1, 4, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 4, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG16 | (FORMAT_R16 << 8):
-				_convert_fast<uint16_t, 2, 1, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 1, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG16 | (FORMAT_RGB16 << 8):
-				_convert_fast<uint16_t, 2, 3, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 3, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG16 | (FORMAT_RGBA16 << 8):
-				_convert_fast<uint16_t, 2, 4, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 4, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB16 | (FORMAT_R16 << 8):
-				_convert_fast<uint16_t, 3, 1, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 1, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB16 | (FORMAT_RG16 << 8):
-				_convert_fast<uint16_t, 3, 2, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 2, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB16 | (FORMAT_RGBA16 << 8):
-				_convert_fast<uint16_t, 3, 4, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 4, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA16 | (FORMAT_R16 << 8):
-				_convert_fast<uint16_t, 4, 1, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 1, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA16 | (FORMAT_RG16 << 8):
-				_convert_fast<uint16_t, 4, 2, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 2, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA16 | (FORMAT_RGB16 << 8):
-				_convert_fast<uint16_t, 4, 3, 0x0000, 0xFFFF>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 3, 0x0000, 0xFFFF>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R16I | (FORMAT_RG16I << 8):
-				_convert_fast<uint16_t, 1, 2, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 2, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R16I | (FORMAT_RGB16I << 8):
-				_convert_fast<uint16_t, 1, 3, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 3, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_R16I | (FORMAT_RGBA16I << 8):
-				_convert_fast<uint16_t, 1, 4, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 1, 4, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG16I | (FORMAT_R16I << 8):
-				_convert_fast<uint16_t, 2, 1, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 1, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG16I | (FORMAT_RGB16I << 8):
-				_convert_fast<uint16_t, 2, 3, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 3, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RG16I | (FORMAT_RGBA16I << 8):
-				_convert_fast<uint16_t, 2, 4, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 2, 4, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB16I | (FORMAT_R16I << 8):
-				_convert_fast<uint16_t, 3, 1, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 1, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB16I | (FORMAT_RG16I << 8):
-				_convert_fast<uint16_t, 3, 2, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 2, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGB16I | (FORMAT_RGBA16I << 8):
-				_convert_fast<uint16_t, 3, 4, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 3, 4, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA16I | (FORMAT_R16I << 8):
-				_convert_fast<uint16_t, 4, 1, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 1, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA16I | (FORMAT_RG16I << 8):
-				_convert_fast<uint16_t, 4, 2, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 2, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 			case FORMAT_RGBA16I | (FORMAT_RGB16I << 8):
-				_convert_fast<uint16_t, 4, 3, 0x0000, 0x0001>(mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr);
+				_convert_parallel(_convert_fast<uint16_t, 4, 3, 0x0000, 0x0001>, mip_width, mip_height, (const uint16_t *)rptr, (uint16_t *)wptr, src_pixel_size, dst_pixel_size);
 				break;
 		}
 	}
@@ -895,6 +944,14 @@ enum ImageScaleType {
 	IMAGE_SCALING_FLOAT,
 };
 
+typedef void (*ImageScaleFunc)(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_begin, uint32_t p_dst_y_end);
+
+static void _scale_parallel(ImageScaleFunc p_func, const uint8_t *p_src, uint8_t *p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+	_process_rows(p_dst_width, p_dst_height, [&](uint32_t p_begin, uint32_t p_end) {
+		p_func(p_src, p_dst, p_src_width, p_src_height, p_dst_width, p_dst_height, p_begin, p_end);
+	});
+}
+
 static double _bicubic_interp_kernel(double p_x) {
 	p_x = Math::abs(p_x);
 
@@ -910,7 +967,7 @@ static double _bicubic_interp_kernel(double p_x) {
 }
 
 template <int CC, typename T, ImageScaleType TYPE>
-static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_begin, uint32_t p_dst_y_end) {
 	// get source image size
 	int width = p_src_width;
 	int height = p_src_height;
@@ -925,7 +982,7 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 	int xmax = width - 1;
 	// temporary pointer
 
-	for (uint32_t y = 0; y < p_dst_height; y++) {
+	for (uint32_t y = p_dst_y_begin; y < p_dst_y_end; y++) {
 		// Y coordinates
 		oy = (double)(y + 0.5) * yfac - 0.5;
 		oy1 = (int)oy;
@@ -998,13 +1055,13 @@ static void _scale_cubic(const uint8_t *__restrict p_src, uint8_t *__restrict p_
 }
 
 template <int CC, typename T, ImageScaleType TYPE>
-static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
+static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_begin, uint32_t p_dst_y_end) {
 	constexpr uint32_t FRAC_BITS = 8;
 	constexpr uint32_t FRAC_LEN = (1 << FRAC_BITS);
 	constexpr uint32_t FRAC_HALF = (FRAC_LEN >> 1);
 	constexpr uint32_t FRAC_MASK = FRAC_LEN - 1;
 
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+	for (uint32_t i = p_dst_y_begin; i < p_dst_y_end; i++) {
 		// Add 0.5 in order to interpolate based on pixel center
 		uint32_t src_yofs_up_fp = (i + 0.5) * p_src_height * FRAC_LEN / p_dst_height;
 		// Calculate nearest src pixel center above current, and truncate to get y index
@@ -1103,8 +1160,8 @@ static void _scale_bilinear(const uint8_t *__restrict p_src, uint8_t *__restrict
 }
 
 template <int CC, typename T>
-static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height) {
-	for (uint32_t i = 0; i < p_dst_height; i++) {
+static void _scale_nearest(const uint8_t *__restrict p_src, uint8_t *__restrict p_dst, uint32_t p_src_width, uint32_t p_src_height, uint32_t p_dst_width, uint32_t p_dst_height, uint32_t p_dst_y_begin, uint32_t p_dst_y_end) {
+	for (uint32_t i = p_dst_y_begin; i < p_dst_y_end; i++) {
 		uint32_t src_yofs = (i + 0.5) * p_src_height / p_dst_height;
 		uint32_t y_ofs = src_yofs * p_src_width * CC;
 
@@ -1342,62 +1399,62 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_nearest<1, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<1, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_nearest<2, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<2, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_nearest<3, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<3, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<4, uint8_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<4, uint8_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_nearest<1, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<1, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<2, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<2, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_nearest<3, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<3, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_nearest<4, float>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<4, float>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_nearest<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_nearest<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_R16 && format <= FORMAT_RGBA16I) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_nearest<1, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<1, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_nearest<2, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<2, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_nearest<3, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<3, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_nearest<4, uint16_t>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_nearest<4, uint16_t>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -1444,61 +1501,61 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 				if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 					switch (get_format_pixel_size(format)) {
 						case 1:
-							_scale_bilinear<1, uint8_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<1, uint8_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 2:
-							_scale_bilinear<2, uint8_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<2, uint8_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 3:
-							_scale_bilinear<3, uint8_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<3, uint8_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<4, uint8_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<4, uint8_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 					switch (get_format_pixel_size(format)) {
 						case 4:
-							_scale_bilinear<1, float, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<1, float, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<2, float, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<2, float, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 12:
-							_scale_bilinear<3, float, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<3, float, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 16:
-							_scale_bilinear<4, float, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<4, float, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 					switch (get_format_pixel_size(format)) {
 						case 2:
-							_scale_bilinear<1, uint16_t, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<1, uint16_t, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<2, uint16_t, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<2, uint16_t, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 6:
-							_scale_bilinear<3, uint16_t, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<3, uint16_t, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<4, uint16_t, IMAGE_SCALING_FLOAT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<4, uint16_t, IMAGE_SCALING_FLOAT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				} else if (format >= FORMAT_R16 && format <= FORMAT_RGBA16I) {
 					switch (get_format_pixel_size(format)) {
 						case 2:
-							_scale_bilinear<1, uint16_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<1, uint16_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 4:
-							_scale_bilinear<2, uint16_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<2, uint16_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 6:
-							_scale_bilinear<3, uint16_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<3, uint16_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 						case 8:
-							_scale_bilinear<4, uint16_t, IMAGE_SCALING_INT>(src_ptr, w_ptr, src_width, src_height, p_width, p_height);
+							_scale_parallel(_scale_bilinear<4, uint16_t, IMAGE_SCALING_INT>, src_ptr, w_ptr, src_width, src_height, p_width, p_height);
 							break;
 					}
 				}
@@ -1515,61 +1572,61 @@ void Image::resize(int p_width, int p_height, Interpolation p_interpolation) {
 			if (format >= FORMAT_L8 && format <= FORMAT_RGBA8) {
 				switch (get_format_pixel_size(format)) {
 					case 1:
-						_scale_cubic<1, uint8_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<1, uint8_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 2:
-						_scale_cubic<2, uint8_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<2, uint8_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 3:
-						_scale_cubic<3, uint8_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<3, uint8_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<4, uint8_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<4, uint8_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RF && format <= FORMAT_RGBAF) {
 				switch (get_format_pixel_size(format)) {
 					case 4:
-						_scale_cubic<1, float, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<1, float, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<2, float, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<2, float, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 12:
-						_scale_cubic<3, float, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<3, float, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 16:
-						_scale_cubic<4, float, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<4, float, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_RH && format <= FORMAT_RGBAH) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_cubic<1, uint16_t, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<1, uint16_t, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<2, uint16_t, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<2, uint16_t, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_cubic<3, uint16_t, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<3, uint16_t, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<4, uint16_t, IMAGE_SCALING_FLOAT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<4, uint16_t, IMAGE_SCALING_FLOAT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			} else if (format >= FORMAT_R16 && format <= FORMAT_RGBA16I) {
 				switch (get_format_pixel_size(format)) {
 					case 2:
-						_scale_cubic<1, uint16_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<1, uint16_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 4:
-						_scale_cubic<2, uint16_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<2, uint16_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 6:
-						_scale_cubic<3, uint16_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<3, uint16_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 					case 8:
-						_scale_cubic<4, uint16_t, IMAGE_SCALING_INT>(r_ptr, w_ptr, width, height, p_width, p_height);
+						_scale_parallel(_scale_cubic<4, uint16_t, IMAGE_SCALING_INT>, r_ptr, w_ptr, width, height, p_width, p_height);
 						break;
 				}
 			}
@@ -2200,7 +2257,14 @@ Error Image::generate_mipmaps(bool p_renormalize) {
 		int w, h;
 		_get_mipmap_offset_and_size(i, ofs, w, h);
 
-		_generate_mipmap_from_format(format, wp + prev_ofs, wp + ofs, prev_w, prev_h, p_renormalize);
+		// Each destination row only reads two source rows, so bands are independent.
+		const uint32_t pixel_size = get_format_pixel_size(format);
+		const uint8_t *src = wp + prev_ofs;
+		uint8_t *dst = wp + ofs;
+		_process_rows(w, h, [&](uint32_t p_begin, uint32_t p_end) {
+			const uint32_t src_rows = p_end == (uint32_t)h ? prev_h - p_begin * 2 : (p_end - p_begin) * 2;
+			_generate_mipmap_from_format(format, src + uint64_t(p_begin) * 2 * prev_w * pixel_size, dst + uint64_t(p_begin) * w * pixel_size, prev_w, src_rows, p_renormalize);
+		});
 
 		prev_ofs = ofs;
 		prev_w = w;
@@ -2928,6 +2992,15 @@ int64_t Image::get_image_mipmap_offset_and_dimensions(int p_width, int p_height,
 	return _get_dst_image_size(p_width, p_height, p_format, mm, p_mipmap - 1, &r_w, &r_h);
 }
 
+void Image::compress_block_rows(uint32_t p_block_rows, uint32_t p_blocks_per_row, CompressBlockRowsFunc p_func, void *p_userdata) {
+	ERR_FAIL_NULL(p_func);
+	_process_rows(
+			p_blocks_per_row, p_block_rows, [&](uint32_t p_begin, uint32_t p_end) {
+				p_func(p_userdata, p_begin, p_end);
+			},
+			IMAGE_COMPRESS_MIN_BLOCKS);
+}
+
 bool Image::is_compressed() const {
 	return is_format_compressed(format);
 }
@@ -250,6 +250,12 @@ public:
 	static Error (*_image_compress_bptc_rd_func)(Image *, UsedChannels p_channels, BPTCFormat p_bptc_format);
 	static Error (*_image_compress_bc_rd_func)(Image *, UsedChannels p_channels);
 
+	// Encodes independent rows of blocks on the WorkerThreadPool, calling `p_func` with
+	// ranges of block rows. Used by compressors without their own threading. Runs inline
+	// when called from a pool thread, such as an import task.
+	typedef void (*CompressBlockRowsFunc)(void *p_userdata, uint32_t p_from, uint32_t p_to);
+	static void compress_block_rows(uint32_t p_block_rows, uint32_t p_blocks_per_row, CompressBlockRowsFunc p_func, void *p_userdata);
+
 	// External VRAM decompression function pointers.
 
 	static void (*_image_decompress_bc)(Image *);
@@ -32,6 +32,7 @@
 
 #include "core/crypto/crypto_core.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_compressed.h"
 #include "core/io/file_access_encrypted.h"
 #include "core/io/file_access_pack.h" // PACK_HEADER_MAGIC, PACK_FORMAT_VERSION
 #include "core/object/class_db.h"
@@ -52,6 +53,7 @@ void PCKPacker::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("add_file", "target_path", "source_path", "encrypt"), &PCKPacker::add_file, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_from_buffer", "target_path", "data", "encrypt"), &PCKPacker::add_file_from_buffer, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("add_file_removal", "target_path"), &PCKPacker::add_file_removal);
+	ClassDB::bind_method(D_METHOD("set_file_compression", "enabled", "mode"), &PCKPacker::set_file_compression, DEFVAL(FileAccess::COMPRESSION_ZSTD));
 	ClassDB::bind_method(D_METHOD("flush", "verbose"), &PCKPacker::flush, DEFVAL(false));
 }
 
@@ -125,6 +127,7 @@ Error PCKPacker::pck_start(const String &p_pck_path, int p_alignment, const Stri
 	file->seek(file_base);
 
 	files.clear();
+	stored_contents.clear();
 
 	return OK;
 }
@@ -147,6 +150,12 @@ Error PCKPacker::add_file_removal(const String &p_target_path) {
 	return OK;
 }
 
+void PCKPacker::set_file_compression(bool p_enabled, FileAccess::CompressionMode p_mode) {
+	ERR_FAIL_COND_MSG(p_mode == FileAccess::COMPRESSION_BROTLI, "Brotli is only supported for decompression, it can't be used to compress files.");
+	compress_files = p_enabled;
+	compression_mode = p_mode;
+}
+
 Error PCKPacker::add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt) {
 	ERR_FAIL_COND_V_MSG(file.is_null(), ERR_INVALID_PARAMETER, "File must be opened before use.");
 
@@ -184,6 +193,33 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 	}
 	pf.encrypted = p_encrypt;
 
+	String content_key;
+	{
+		unsigned char hash[32];
+		CryptoCore::sha256(p_data.ptr(), p_data.size(), hash);
+		content_key = String::hex_encode_buffer(hash, 32) + itos(p_data.size()) + (p_encrypt ? "e" : "") + (compress_files ? itos(compression_mode) : "");
+	}
+
+	const int *stored = stored_contents.getptr(content_key);
+	if (stored) {
+		// Same content was already written, point to it instead of storing it again.
+		const File &stored_file = files[*stored];
+		pf.ofs = stored_file.ofs;
+		pf.size = stored_file.size;
+		pf.compressed = stored_file.compressed;
+		files.push_back(pf);
+		return OK;
+	}
+
+	// Files larger than 4 GiB can't be compressed and are stored as is.
+	Vector<uint8_t> compressed;
+	if (compress_files && (uint64_t)p_data.size() <= UINT32_MAX) {
+		compressed = FileAccessCompressed::compress_buffer(p_data.ptr(), p_data.size(), PACK_FILE_COMPRESSED_MAGIC, (Compression::Mode)compression_mode);
+		ERR_FAIL_COND_V_MSG(compressed.is_empty(), ERR_CANT_CREATE, vformat("Can't compress file: '%s'.", p_source_path));
+		pf.compressed = true;
+		pf.size = compressed.size();
+	}
+
 	Ref<FileAccess> ftmp = file;
 
 	Ref<FileAccessEncrypted> fae;
@@ -196,7 +232,7 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 		ftmp = fae;
 	}
 
-	ftmp->store_buffer(p_data);
+	ftmp->store_buffer(pf.compressed ? compressed : p_data);
 
 	if (fae.is_valid()) {
 		ftmp.unref();
@@ -208,6 +244,7 @@ Error PCKPacker::_add_file(const String &p_target_path, const String &p_source_p
 		file->store_8(0);
 	}
 
+	stored_contents.insert(content_key, files.size());
 	files.push_back(pf);
 
 	return OK;
@@ -265,6 +302,9 @@ Error PCKPacker::flush(bool p_verbose) {
 		if (files[i].removal) {
 			flags |= PACK_FILE_REMOVAL;
 		}
+		if (files[i].compressed) {
+			flags |= PACK_FILE_COMPRESSED;
+		}
 		fhead->store_32(flags);
 
 		if (p_verbose) {
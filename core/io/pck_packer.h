@@ -30,9 +30,9 @@
 
 #pragma once
 
+#include "core/io/file_access.h"
 #include "core/object/ref_counted.h"
-
-class FileAccess;
+#include "core/templates/hash_map.h"
 
 class PCKPacker : public RefCounted {
 	GDCLASS(PCKPacker, RefCounted);
@@ -43,6 +43,9 @@ class PCKPacker : public RefCounted {
 	Vector<uint8_t> key;
 	bool enc_dir = false;
 
+	bool compress_files = false;
+	FileAccess::CompressionMode compression_mode = FileAccess::COMPRESSION_ZSTD;
+
 	uint64_t file_base = 0;
 	uint64_t file_base_ofs = 0;
 	uint64_t dir_base_ofs = 0;
@@ -55,10 +58,13 @@ class PCKPacker : public RefCounted {
 		uint64_t ofs = 0;
 		uint64_t size = 0;
 		bool encrypted = false;
+		bool compressed = false;
 		bool removal = false;
 		Vector<uint8_t> md5;
 	};
 	Vector<File> files;
+	// Identical contents are stored once and shared by all paths that reference them.
+	HashMap<String, int> stored_contents; // Content hash and storage flags -> index in `files`.
 
 	Error _add_file(const String &p_target_path, const String &p_source_path, const Vector<uint8_t> &p_data, bool p_encrypt = false);
 
@@ -67,6 +73,7 @@ public:
 	Error add_file(const String &p_target_path, const String &p_source_path, bool p_encrypt = false);
 	Error add_file_from_buffer(const String &p_target_path, const Vector<uint8_t> &p_data, bool p_encrypt = false);
 	Error add_file_removal(const String &p_target_path);
+	void set_file_compression(bool p_enabled, FileAccess::CompressionMode p_mode = FileAccess::COMPRESSION_ZSTD);
 	Error flush(bool p_verbose = false);
 
 	~PCKPacker();
@@ -33,9 +33,11 @@
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access_compressed.h"
+#include "core/io/file_access_memory.h"
 #include "core/io/missing_resource.h"
 #include "core/object/class_db.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/version.h"
 #include "scene/property_utils.h"
 #include "scene/resources/packed_scene.h"
@@ -376,6 +378,18 @@ Error ResourceLoaderBinary::parse_variant(Variant &r_v) {
 		case VARIANT_OBJECT: {
 			uint32_t objtype = f->get_32();
 
+			if (skip_object_references && objtype != OBJECT_EMPTY) {
+				if (objtype == OBJECT_EXTERNAL_RESOURCE) {
+					String exttype = get_unicode_string();
+					String path = get_unicode_string();
+				} else {
+					f->get_32();
+				}
+				skipped_object_reference = true;
+				r_v = Variant();
+				break;
+			}
+
 			switch (objtype) {
 				case OBJECT_EMPTY: {
 					//do none
@@ -647,6 +661,35 @@ Error ResourceLoaderBinary::load() {
 		}
 	}
 
+	// When sub-threads are allowed, decode the properties of internal resources concurrently.
+	// Resources referencing other resources are decoded again by the sequential pass below,
+	// which is always the case for the root of a PackedScene, as its nodes reference them.
+	// Loads already running on a pool thread decode inline in that pass instead, as waiting
+	// there for a group could deadlock once every pool thread is a waiting loader.
+	LocalVector<ParsedResource> parsed_resources;
+	if (use_sub_threads && internal_resources.size() > 1 && WorkerThreadPool::get_singleton()->get_thread_index() == -1 && !f->get_mapped_data().is_empty()) {
+		parsed_resources.resize(internal_resources.size());
+		uint32_t to_parse = parsed_resources.size();
+		if (cache_mode == ResourceFormatLoader::CACHE_MODE_REUSE) {
+			// Same lookup as the sequential pass, which reuses these without reading them.
+			for (int i = 0; i < internal_resources.size() - 1; i++) {
+				String path = internal_resources[i].path;
+				if (path.begins_with("local://")) {
+					path = res_path + "::" + path.replace_first("local://", "");
+				}
+				if (ResourceCache::has(path) && ResourceCache::get_ref(path).is_valid()) {
+					parsed_resources[i].cached = true;
+					to_parse--;
+				}
+			}
+		}
+
+		if (to_parse > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &ResourceLoaderBinary::_parse_internal_resource_task, parsed_resources.ptr(), parsed_resources.size(), -1, true, "ParseInternalResources");
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+		}
+	}
+
 	for (int i = 0; i < internal_resources.size(); i++) {
 		bool main = i == (internal_resources.size() - 1);
 
@@ -686,6 +729,8 @@ Error ResourceLoaderBinary::load() {
 
 		String t = get_unicode_string();
 
+		ParsedResource *parsed = (uint32_t)i < parsed_resources.size() && parsed_resources[i].parsed ? &parsed_resources[i] : nullptr;
+
 		Ref<Resource> res;
 		Resource *r = nullptr;
 
@@ -749,25 +794,31 @@ Error ResourceLoaderBinary::load() {
 			internal_index_cache[path] = res;
 		}
 
-		int pc = f->get_32();
+		int pc = parsed ? (int)parsed->properties.size() : f->get_32();
 
 		//set properties
 
 		Dictionary missing_resource_properties;
 
 		for (int j = 0; j < pc; j++) {
-			StringName name = _get_string();
+			StringName name;
+			Variant value;
 
-			if (name == StringName()) {
-				error = ERR_FILE_CORRUPT;
-				ERR_FAIL_V(ERR_FILE_CORRUPT);
-			}
+			if (parsed) {
+				name = parsed->properties[j].first;
+				value = parsed->properties[j].second;
+			} else {
+				name = _get_string();
 
-			Variant value;
+				if (name == StringName()) {
+					error = ERR_FILE_CORRUPT;
+					ERR_FAIL_V(ERR_FILE_CORRUPT);
+				}
 
-			error = parse_variant(value);
-			if (error) {
-				return error;
+				error = parse_variant(value);
+				if (error) {
+					return error;
+				}
 			}
 
 			bool set_valid = true;
@@ -821,6 +872,10 @@ Error ResourceLoaderBinary::load() {
 			res->set_meta(META_MISSING_RESOURCES, missing_resource_properties);
 		}
 
+		if (parsed) {
+			parsed->properties.clear();
+		}
+
 #ifdef TOOLS_ENABLED
 		res->set_edited(false);
 #endif
@@ -843,6 +898,46 @@ Error ResourceLoaderBinary::load() {
 	return ERR_FILE_EOF;
 }
 
+void ResourceLoaderBinary::_parse_internal_resource_task(uint32_t p_index, ParsedResource *p_parsed) {
+	if (p_parsed[p_index].cached) {
+		return;
+	}
+
+	const Span<uint8_t> data = f->get_mapped_data();
+
+	Ref<FileAccessMemory> fm;
+	fm.instantiate();
+	fm->open_custom(data.ptr(), data.size());
+	fm->set_big_endian(f->is_big_endian());
+	fm->real_is_double = f->real_is_double;
+
+	ResourceLoaderBinary parser;
+	parser.f = fm;
+	parser.ver_format = ver_format;
+	parser.string_map = string_map;
+	parser.skip_object_references = true;
+
+	fm->seek(internal_resources[p_index].offset);
+	String type = parser.get_unicode_string(); // Handled by the sequential pass.
+
+	ParsedResource &parsed = p_parsed[p_index];
+	const uint32_t pc = fm->get_32();
+	if (pc > data.size()) {
+		return;
+	}
+	parsed.properties.resize(pc);
+
+	for (uint32_t i = 0; i < pc; i++) {
+		parsed.properties[i].first = parser._get_string();
+		if (parsed.properties[i].first == StringName() || parser.parse_variant(parsed.properties[i].second) != OK || parser.skipped_object_reference) {
+			parsed.properties.clear();
+			return;
+		}
+	}
+
+	parsed.parsed = true;
+}
+
 void ResourceLoaderBinary::set_translation_remapped(bool p_remapped) {
 	translation_remapped = p_remapped;
 }
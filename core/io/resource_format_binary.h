@@ -33,6 +33,8 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/pair.h"
 #include "core/templates/rb_map.h"
 
 class ResourceLoaderBinary {
@@ -78,6 +80,19 @@ class ResourceLoaderBinary {
 	Vector<IntResource> internal_resources;
 	HashMap<String, Ref<Resource>> internal_index_cache;
 
+	struct ParsedResource {
+		bool cached = false; // Reused from the cache, so not decoded at all.
+		bool parsed = false;
+		LocalVector<Pair<StringName, Variant>> properties;
+	};
+
+	// Set on the loaders used to decode internal resources on worker threads.
+	// Object references are skipped and flagged, as they can only be resolved in order.
+	bool skip_object_references = false;
+	bool skipped_object_reference = false;
+
+	void _parse_internal_resource_task(uint32_t p_index, ParsedResource *p_parsed);
+
 	String get_unicode_string();
 	void _advance_padding(uint32_t p_len);
 
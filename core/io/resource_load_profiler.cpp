@@ -0,0 +1,250 @@
+/**************************************************************************/
+/*  resource_load_profiler.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "resource_load_profiler.h"
+
+#include "core/io/file_access.h"
+#include "core/io/json.h"
+#include "core/os/os.h"
+#include "core/templates/hash_map.h"
+
+void ResourceLoadProfiler::start(const String &p_output_path) {
+	output_path = p_output_path;
+	enabled = true;
+}
+
+void ResourceLoadProfiler::stop() {
+	enabled = false;
+	load_stack.clear();
+
+	MutexLock lock(mutex);
+	records.clear();
+}
+
+void ResourceLoadProfiler::begin_load(const String &p_path, const String &p_type_hint) {
+	if (!enabled) {
+		return;
+	}
+
+	Record record;
+	record.path = p_path;
+	record.type_hint = p_type_hint;
+	record.thread_id = Thread::get_caller_id();
+	record.begin_usec = OS::get_singleton()->get_ticks_usec();
+	record.bytes_read = FileAccess::get_thread_bytes_read(); // Turned into a delta in end_load().
+	load_stack.push_back(record);
+}
+
+void ResourceLoadProfiler::end_load(Error p_error) {
+	if (!enabled || load_stack.is_empty()) {
+		return;
+	}
+
+	Record record = load_stack[load_stack.size() - 1];
+	load_stack.remove_at(load_stack.size() - 1);
+
+	record.end_usec = OS::get_singleton()->get_ticks_usec();
+	record.error = p_error;
+	const uint64_t bytes_read = FileAccess::get_thread_bytes_read() - record.bytes_read;
+	record.bytes_read = bytes_read - record.nested_bytes_read;
+
+	if (!load_stack.is_empty()) {
+		Record &parent = load_stack[load_stack.size() - 1];
+		parent.nested_usec += record.end_usec - record.begin_usec;
+		parent.nested_bytes_read += bytes_read;
+		if (!parent.dependencies.has(record.path)) {
+			parent.dependencies.push_back(record.path);
+		}
+	}
+
+	MutexLock lock(mutex);
+	records.push_back(record);
+}
+
+uint64_t ResourceLoadProfiler::begin_wait() {
+	if (!enabled || load_stack.is_empty()) {
+		return 0;
+	}
+
+	// Loads running on this thread while waiting are accounted for separately.
+	return OS::get_singleton()->get_ticks_usec() - load_stack[load_stack.size() - 1].nested_usec;
+}
+
+void ResourceLoadProfiler::end_wait(const String &p_path, uint64_t p_wait_begin) {
+	if (!enabled || load_stack.is_empty() || p_wait_begin == 0) {
+		return;
+	}
+
+	Record &record = load_stack[load_stack.size() - 1];
+	record.wait_usec += OS::get_singleton()->get_ticks_usec() - record.nested_usec - p_wait_begin;
+	if (!record.dependencies.has(p_path)) {
+		record.dependencies.push_back(p_path);
+	}
+}
+
+String ResourceLoadProfiler::get_chrome_trace() {
+	MutexLock lock(mutex);
+
+	Array events;
+	for (const Record &record : records) {
+		Array dependencies;
+		for (const String &dependency : record.dependencies) {
+			dependencies.push_back(dependency);
+		}
+
+		Dictionary args;
+		args["type_hint"] = record.type_hint;
+		args["self_usec"] = record.get_self_usec();
+		args["wait_usec"] = record.wait_usec;
+		args["bytes_read"] = record.bytes_read;
+		args["error"] = error_names[record.error];
+		args["dependencies"] = dependencies;
+
+		Dictionary event;
+		event["name"] = record.path;
+		event["cat"] = "resource";
+		event["ph"] = "X";
+		event["ts"] = record.begin_usec;
+		event["dur"] = record.end_usec - record.begin_usec;
+		event["pid"] = 0;
+		event["tid"] = record.thread_id;
+		event["args"] = args;
+		events.push_back(event);
+	}
+
+	Dictionary trace;
+	trace["traceEvents"] = events;
+	trace["displayTimeUnit"] = "ms";
+	return JSON::stringify(trace, "", false);
+}
+
+LocalVector<String> ResourceLoadProfiler::get_critical_path(uint64_t *r_usec) {
+	MutexLock lock(mutex);
+
+	// The critical path is the chain of dependencies with the most time spent in
+	// the loads themselves. No amount of parallelism can make loading faster than it.
+	HashMap<String, uint32_t> record_indices;
+	for (uint32_t i = 0; i < records.size(); i++) {
+		record_indices[records[i].path] = i;
+	}
+
+	enum VisitState : uint8_t {
+		UNVISITED,
+		VISITING,
+		VISITED,
+	};
+	LocalVector<VisitState> states;
+	states.resize_initialized(records.size());
+	LocalVector<uint64_t> costs;
+	costs.resize_initialized(records.size());
+	LocalVector<int64_t> next;
+	next.resize(records.size());
+
+	// Iterative post-order traversal, as dependency chains can be deep.
+	LocalVector<uint32_t> stack;
+	for (uint32_t root = 0; root < records.size(); root++) {
+		if (states[root] != UNVISITED) {
+			continue;
+		}
+		stack.push_back(root);
+		while (!stack.is_empty()) {
+			const uint32_t index = stack[stack.size() - 1];
+			if (states[index] == UNVISITED) {
+				states[index] = VISITING;
+				for (const String &dependency : records[index].dependencies) {
+					const uint32_t *dependency_index = record_indices.getptr(dependency);
+					if (dependency_index && states[*dependency_index] == UNVISITED) {
+						stack.push_back(*dependency_index);
+					}
+				}
+				continue;
+			}
+
+			stack.remove_at(stack.size() - 1);
+			if (states[index] == VISITED) {
+				continue;
+			}
+
+			// Dependencies still being visited are part of a cycle and are ignored.
+			uint64_t max_cost = 0;
+			next[index] = -1;
+			for (const String &dependency : records[index].dependencies) {
+				const uint32_t *dependency_index = record_indices.getptr(dependency);
+				if (dependency_index && states[*dependency_index] == VISITED && costs[*dependency_index] > max_cost) {
+					max_cost = costs[*dependency_index];
+					next[index] = *dependency_index;
+				}
+			}
+			costs[index] = records[index].get_self_usec() + max_cost;
+			states[index] = VISITED;
+		}
+	}
+
+	int64_t index = -1;
+	uint64_t cost = 0;
+	for (uint32_t i = 0; i < records.size(); i++) {
+		if (index == -1 || costs[i] > cost) {
+			index = i;
+			cost = costs[i];
+		}
+	}
+
+	if (r_usec) {
+		*r_usec = cost;
+	}
+
+	LocalVector<String> path;
+	while (index != -1) {
+		path.push_back(records[index].path);
+		index = next[index];
+	}
+	return path;
+}
+
+void ResourceLoadProfiler::dump() {
+	if (!enabled) {
+		return;
+	}
+
+	Ref<FileAccess> f = FileAccess::open(output_path, FileAccess::WRITE);
+	if (f.is_valid()) {
+		f->store_string(get_chrome_trace());
+		print_line(vformat("Resource load trace written to \"%s\".", output_path));
+	} else {
+		ERR_PRINT(vformat("Can't write resource load trace to \"%s\".", output_path));
+	}
+
+	uint64_t critical_usec = 0;
+	const LocalVector<String> critical_path = get_critical_path(&critical_usec);
+	print_line(vformat("Resource loading critical path (%.2f msec):", critical_usec / 1000.0));
+	for (const String &path : critical_path) {
+		print_line("\t" + path);
+	}
+}
@@ -0,0 +1,81 @@
+/**************************************************************************/
+/*  resource_load_profiler.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/string/ustring.h"
+#include "core/templates/local_vector.h"
+
+// Records how long each resource takes to load, for finding what makes loading slow.
+// Enabled with the `--profile-resource-loading <path>` command line argument, which
+// writes a Chrome trace of all loads on exit and prints their critical path.
+class ResourceLoadProfiler {
+public:
+	struct Record {
+		String path;
+		String type_hint;
+		Thread::ID thread_id = 0;
+		uint64_t begin_usec = 0;
+		uint64_t end_usec = 0;
+		uint64_t wait_usec = 0; // Time spent blocked on dependencies loading elsewhere.
+		uint64_t nested_usec = 0; // Time spent loading dependencies on the same thread.
+		uint64_t bytes_read = 0; // Excludes dependencies loaded on the same thread.
+		uint64_t nested_bytes_read = 0;
+		Error error = OK;
+		LocalVector<String> dependencies;
+
+		uint64_t get_self_usec() const { return end_usec - begin_usec - wait_usec - nested_usec; }
+	};
+
+private:
+	static inline bool enabled = false;
+	static inline String output_path;
+
+	static inline BinaryMutex mutex;
+	static inline LocalVector<Record> records;
+
+	static inline thread_local LocalVector<Record> load_stack;
+
+public:
+	static void start(const String &p_output_path);
+	static void stop();
+	_FORCE_INLINE_ static bool is_enabled() { return enabled; }
+
+	static void begin_load(const String &p_path, const String &p_type_hint);
+	static void end_load(Error p_error);
+	static uint64_t begin_wait();
+	static void end_wait(const String &p_path, uint64_t p_wait_begin);
+
+	static String get_chrome_trace();
+	static LocalVector<String> get_critical_path(uint64_t *r_usec = nullptr);
+	static void dump();
+};
@@ -36,6 +36,7 @@
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
 #include "core/io/resource_importer.h"
+#include "core/io/resource_load_profiler.h"
 #include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
 #include "core/object/message_queue.h"
@@ -277,16 +278,18 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 	load_nesting++;
 
 	print_verbose(vformat("Loading resource: %s remapped: %s", p_path, _path_remap(p_path)));
+	ResourceLoadProfiler::begin_load(p_path, p_type_hint);
 
 	// Try all loaders and pick the first match for the type hint
 	bool found = false;
 	Ref<Resource> res;
+	Error err = OK; // Kept locally so the profiler sees the final error, even if r_error is null.
 	for (int i = 0; i < loader_count; i++) {
 		if (!loader[i]->recognize_path(p_path, p_type_hint)) {
 			continue;
 		}
 		found = true;
-		res = loader[i]->load(p_path, original_path, r_error, p_use_sub_threads, r_progress, p_cache_mode);
+		res = loader[i]->load(p_path, original_path, &err, p_use_sub_threads, r_progress, p_cache_mode);
 		if (res.is_valid()) {
 			break;
 		}
@@ -296,6 +299,10 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 	load_nesting--;
 
 	if (res.is_valid()) {
+		if (r_error) {
+			*r_error = err;
+		}
+		ResourceLoadProfiler::end_load(OK);
 		return res;
 	} else {
 		print_verbose(vformat("Failed loading resource: %s", p_path));
@@ -307,14 +314,21 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 			// The format is known to the editor, but the file hasn't been imported
 			// (otherwise, ResourceFormatImporter would have been found as a suitable loader).
 			found = true;
-			if (r_error) {
-				*r_error = ERR_FILE_NOT_FOUND;
-			}
+			err = ERR_FILE_NOT_FOUND;
 		}
 	}
 #endif
 
-	ERR_FAIL_COND_V_MSG(found, Ref<Resource>(), vformat("Failed loading resource: %s.", p_path));
+	if (found) {
+		if (err == OK) {
+			err = ERR_CANT_OPEN; // The loader failed without saying why.
+		}
+		if (r_error) {
+			*r_error = err;
+		}
+		ResourceLoadProfiler::end_load(err);
+		ERR_FAIL_V_MSG(Ref<Resource>(), vformat("Failed loading resource: %s.", p_path));
+	}
 
 #ifdef TOOLS_ENABLED
 	Ref<FileAccess> file_check = FileAccess::create(FileAccess::ACCESS_RESOURCES);
@@ -322,6 +336,7 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 		if (r_error) {
 			*r_error = ERR_FILE_NOT_FOUND;
 		}
+		ResourceLoadProfiler::end_load(ERR_FILE_NOT_FOUND);
 		ERR_FAIL_V_MSG(Ref<Resource>(), vformat("Resource file not found: %s (expected type: %s)", p_path, !p_type_hint.is_empty() ? p_type_hint : "unknown"));
 	}
 #endif
@@ -329,6 +344,7 @@ Ref<Resource> ResourceLoader::_load(const String &p_path, const String &p_origin
 	if (r_error) {
 		*r_error = ERR_FILE_UNRECOGNIZED;
 	}
+	ResourceLoadProfiler::end_load(ERR_FILE_UNRECOGNIZED);
 	ERR_FAIL_V_MSG(Ref<Resource>(), vformat("No loader found for resource: %s (expected type: %s)", p_path, !p_type_hint.is_empty() ? p_type_hint : "unknown"));
 }
 
@@ -1001,8 +1017,14 @@ Ref<Resource> ResourceLoader::load_threaded_get(const String &p_path, Error *r_e
 }
 
 Ref<Resource> ResourceLoader::_load_complete(LoadToken &p_load_token, Error *r_error) {
-	MutexLock thread_load_lock(thread_load_mutex);
-	return _load_complete_inner(p_load_token, r_error, thread_load_lock);
+	const uint64_t wait_begin = ResourceLoadProfiler::begin_wait();
+	Ref<Resource> res;
+	{
+		MutexLock thread_load_lock(thread_load_mutex);
+		res = _load_complete_inner(p_load_token, r_error, thread_load_lock);
+	}
+	ResourceLoadProfiler::end_wait(p_load_token.local_path, wait_begin);
+	return res;
 }
 
 void ResourceLoader::set_is_import_thread(bool p_import_thread) {
@@ -1733,6 +1733,53 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+const ClassDB::ClassInfo *ClassDB::get_native_class_for_instantiation(const StringName &p_class) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *ti = classes.getptr(p_class);
+	if (!_can_instantiate(ti) && compat_classes.has(p_class)) {
+		ti = classes.getptr(compat_classes[p_class]);
+	}
+	if (!_can_instantiate(ti) || ti->gdextension) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR || ti->api == API_EDITOR_EXTENSION || (ti->is_runtime && Engine::get_singleton()->is_editor_hint())) {
+		return nullptr;
+	}
+#endif
+	return ti;
+}
+
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const ClassInfo *p_class, const StringName &p_property) {
+	Locker::Lock lock(Locker::STATE_READ);
+	const ClassInfo *check = p_class;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	Locker::Lock lock(Locker::STATE_READ);
+	const ClassInfo *check = classes.getptr(p_class);
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
@@ -480,6 +480,12 @@ public:
 	static StringName get_property_setter(const StringName &p_class, const StringName &p_property);
 	static StringName get_property_getter(const StringName &p_class, const StringName &p_property);
 
+	// For callers that create the same classes and set the same properties repeatedly, such as
+	// PackedScene instantiation. Only native classes created through `creation_func` are returned.
+	static const ClassInfo *get_native_class_for_instantiation(const StringName &p_class);
+	static const PropertySetGet *get_property_setget(const ClassInfo *p_class, const StringName &p_property);
+	static const PropertySetGet *get_property_setget(const StringName &p_class, const StringName &p_property);
+
 	static bool has_method(const StringName &p_class, const StringName &p_method, bool p_no_inheritance = false);
 	static void set_method_flags(const StringName &p_class, const StringName &p_method, int p_flags);
 
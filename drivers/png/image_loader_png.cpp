@@ -34,6 +34,13 @@
 
 Error ImageLoaderPNG::load_image(Ref<Image> p_image, Ref<FileAccess> f, BitField<ImageFormatLoader::LoaderFlags> p_flags, float p_scale) {
 	const uint64_t buffer_size = f->get_length();
+
+	// Decode straight from the file contents when they are already in memory.
+	const Span<uint8_t> mapped = f->get_mapped_data();
+	if (!mapped.is_empty() && mapped.size() == buffer_size) {
+		return PNGDriverCommon::png_to_image(mapped.ptr(), buffer_size, p_flags & FLAG_FORCE_LINEAR, p_image);
+	}
+
 	Vector<uint8_t> file_buffer;
 	Error err = file_buffer.resize(buffer_size);
 	if (err) {
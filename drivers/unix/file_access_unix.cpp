@@ -35,6 +35,7 @@
 #include "core/string/ustring.h"
 
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #if !defined(__FreeBSD__) && !defined(__OpenBSD__) && !defined(__NetBSD__) && !defined(WEB_ENABLED)
@@ -200,6 +201,12 @@ void FileAccessUnix::_close() {
 		return;
 	}
 
+	if (mapped_data) {
+		munmap(mapped_data, mapped_length);
+		mapped_data = nullptr;
+		mapped_length = 0;
+	}
+
 	fclose(f);
 	f = nullptr;
 
@@ -301,10 +308,40 @@ uint64_t FileAccessUnix::get_buffer(uint8_t *p_dst, uint64_t p_length) const {
 
 	uint64_t read = fread(p_dst, 1, p_length, f);
 	check_errors();
+	thread_bytes_read += read;
 
 	return read;
 }
 
+Span<uint8_t> FileAccessUnix::get_mapped_data() const {
+	ERR_FAIL_NULL_V_MSG(f, Span<uint8_t>(), "File must be opened before use.");
+
+	MutexLock lock(mapping_mutex);
+	if (mapped_data) {
+		return Span<uint8_t>(mapped_data, mapped_length);
+	}
+
+	// Only files opened for reading can be mapped, as writes would invalidate the view.
+	if (flags != READ) {
+		return Span<uint8_t>();
+	}
+
+	int fd = fileno(f);
+	struct stat st = {};
+	if (fd == -1 || fstat(fd, &st) != 0 || st.st_size <= 0) {
+		return Span<uint8_t>();
+	}
+
+	void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	if (data == MAP_FAILED) {
+		return Span<uint8_t>();
+	}
+
+	mapped_data = (uint8_t *)data;
+	mapped_length = st.st_size;
+	return Span<uint8_t>(mapped_data, mapped_length);
+}
+
 Error FileAccessUnix::get_error() const {
 	return last_error;
 }
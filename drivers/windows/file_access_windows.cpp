@@ -346,6 +346,7 @@ uint64_t FileAccessWindows::get_buffer(uint8_t *p_dst, uint64_t p_length) const
 
 	uint64_t read = fread(p_dst, 1, p_length, f);
 	check_errors();
+	thread_bytes_read += read;
 
 	return read;
 }
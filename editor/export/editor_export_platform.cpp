@@ -374,21 +374,26 @@ void EditorExportPlatform::_unload_patches() {
 	patch_temp_dirs.clear();
 }
 
-Error EditorExportPlatform::_encrypt_and_store_data(Ref<FileAccess> p_fd, const String &p_path, const Vector<uint8_t> &p_data, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key, uint64_t p_seed, bool &r_encrypt) {
-	r_encrypt = false;
+bool EditorExportPlatform::_is_path_encrypted(const String &p_path, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters) {
+	bool encrypt = false;
 	for (int i = 0; i < p_enc_in_filters.size(); ++i) {
 		if (p_path.matchn(p_enc_in_filters[i]) || p_path.trim_prefix("res://").matchn(p_enc_in_filters[i])) {
-			r_encrypt = true;
+			encrypt = true;
 			break;
 		}
 	}
 
 	for (int i = 0; i < p_enc_ex_filters.size(); ++i) {
 		if (p_path.matchn(p_enc_ex_filters[i]) || p_path.trim_prefix("res://").matchn(p_enc_ex_filters[i])) {
-			r_encrypt = false;
+			encrypt = false;
 			break;
 		}
 	}
+	return encrypt;
+}
+
+Error EditorExportPlatform::_encrypt_and_store_data(Ref<FileAccess> p_fd, const String &p_path, const Vector<uint8_t> &p_data, const Vector<String> &p_enc_in_filters, const Vector<String> &p_enc_ex_filters, const Vector<uint8_t> &p_key, uint64_t p_seed, bool &r_encrypt) {
+	r_encrypt = _is_path_encrypted(p_path, p_enc_in_filters, p_enc_ex_filters);
 
 	Ref<FileAccessEncrypted> fae;
 	Ref<FileAccess> ftmp = p_fd;
@@ -447,6 +452,39 @@ Error EditorExportPlatform::_save_pack_file(const Ref<EditorExportPreset> &p_pre
 	sd.ofs = (pd->use_sparse_pck) ? 0 : pd->f->get_position();
 	sd.size = p_data.size();
 	sd.delta = p_delta;
+
+	// Store MD5 of original file.
+	{
+		unsigned char hash[16];
+		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
+		sd.md5.resize(16);
+		for (int i = 0; i < 16; i++) {
+			sd.md5.write[i] = hash[i];
+		}
+	}
+
+	// Files with identical content share the same data in the pack. Encrypted data
+	// only depends on the content and seed, so it can be shared as well.
+	String content_key;
+	if (!pd->use_sparse_pck) {
+		unsigned char hash[32];
+		CryptoCore::sha256(p_data.ptr(), p_data.size(), hash);
+		content_key = String::hex_encode_buffer(hash, 32) + itos(p_data.size()) + (_is_path_encrypted(simplified_path, p_enc_in_filters, p_enc_ex_filters) ? "e" : "");
+
+		const int *stored = pd->stored_contents.getptr(content_key);
+		if (stored) {
+			sd.ofs = pd->file_ofs[*stored].ofs;
+			sd.encrypted = pd->file_ofs[*stored].encrypted;
+			pd->file_ofs.push_back(sd);
+
+			// TRANSLATORS: This is an editor progress label describing the storing of a file.
+			if (pd->ep->step(vformat(TTR("Storing File: %s"), p_path), 2 + p_file * 100 / p_total, false)) {
+				return ERR_SKIP;
+			}
+			return OK;
+		}
+	}
+
 	Error err = _encrypt_and_store_data(ftmp, simplified_path, p_data, p_enc_in_filters, p_enc_ex_filters, p_key, p_seed, sd.encrypted);
 	if (err != OK) {
 		return err;
@@ -460,16 +498,7 @@ Error EditorExportPlatform::_save_pack_file(const Ref<EditorExportPreset> &p_pre
 		for (int i = 0; i < pad; i++) {
 			pd->f->store_8(0);
 		}
-	}
-
-	// Store MD5 of original file.
-	{
-		unsigned char hash[16];
-		CryptoCore::md5(p_data.ptr(), p_data.size(), hash);
-		sd.md5.resize(16);
-		for (int i = 0; i < 16; i++) {
-			sd.md5.write[i] = hash[i];
-		}
+		pd->stored_contents.insert(content_key, pd->file_ofs.size());
 	}
 
 	pd->file_ofs.push_back(sd);
@@ -46,6 +46,7 @@
 #include "core/io/file_access_zip.h"
 #include "core/io/image.h"
 #include "core/io/image_loader.h"
+#include "core/io/resource_load_profiler.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/class_db.h"
@@ -64,6 +65,7 @@
 #include "main/main_timer_sync.h"
 #include "main/performance.h"
 #include "main/splash.gen.h"
+#include "scene/main/node_profiler.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/window.h"
 #include "scene/property_list_helper.h"
@@ -684,6 +686,8 @@ void Main::print_help(const char *p_binary) {
 	print_help_option("--fixed-fps <fps>", "Force a fixed number of frames per second. This setting disables real-time synchronization.\n");
 	print_help_option("--delta-smoothing <enable>", "Enable or disable frame delta smoothing [\"enable\", \"disable\"].\n");
 	print_help_option("--print-fps", "Print the frames per second to the stdout.\n");
+	print_help_option("--profile-resource-loading <path>", "Record the timing of every resource load and save it to a given file in Chrome trace JSON format on exit. The critical path of the loads is printed to stdout.\n");
+	print_help_option("--profile-nodes <count>[,<interval>]", "Print the <count> nodes and scenes that spend the most time in process callbacks to the stdout about once per second. Only one of every <interval> frames is measured (default 1).\n");
 #ifdef TOOLS_ENABLED
 	print_help_option("--editor-pseudolocalization", "Enable pseudolocalization for the editor and the project manager.\n", CLI_OPTION_AVAILABILITY_EDITOR);
 #endif
@@ -1971,6 +1975,29 @@ Error Main::setup(const char *execpath, int argc, char *argv[], bool p_second_ph
 			disable_vsync = true;
 		} else if (arg == "--print-fps") {
 			print_fps = true;
+		} else if (arg == "--profile-resource-loading") {
+			if (N) {
+				ResourceLoadProfiler::start(N->get());
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <path> argument for --profile-resource-loading <path>.\n");
+				goto error;
+			}
+		} else if (arg == "--profile-nodes") {
+			if (N) {
+				const String value = N->get();
+				const int count = value.get_slicec(',', 0).to_int();
+				const int interval = value.get_slice_count(",") > 1 ? value.get_slicec(',', 1).to_int() : 1;
+				if (count <= 0 || interval <= 0) {
+					OS::get_singleton()->print("Invalid <count>[,<interval>] argument for --profile-nodes, both must be greater than 0.\n");
+					goto error;
+				}
+				NodeProfiler::start(count, interval, true);
+				N = N->next();
+			} else {
+				OS::get_singleton()->print("Missing <count> argument for --profile-nodes <count>[,<interval>].\n");
+				goto error;
+			}
 #ifdef TOOLS_ENABLED
 		} else if (arg == "--editor-pseudolocalization") {
 			editor_pseudolocalization = true;
@@ -5130,6 +5157,7 @@ bool Main::iteration() {
 		} else {
 			hide_print_fps_attempts--;
 		}
+		NodeProfiler::print_top_costs();
 
 		Engine::get_singleton()->_fps = frames;
 		performance->set_process_time(USEC_TO_SEC(process_max));
@@ -5219,6 +5247,8 @@ void Main::cleanup(bool p_force) {
 		ERR_FAIL_COND(!_start_success);
 	}
 
+	ResourceLoadProfiler::dump();
+
 	// Printing in the usual way can become problematic during/after cleanup.
 	CoreGlobals::print_ready = false;
 
@@ -37,6 +37,7 @@
 #include "core/variant/typed_array.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/packed_scene.h"
 #include "servers/audio/audio_server.h"
 #include "servers/rendering/rendering_server.h"
 
@@ -135,6 +136,9 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(OBJECT_POOLED_INSTANCE_COUNT);
+	BIND_ENUM_CONSTANT(OBJECT_NODE_PATH_CACHE_HITS);
+	BIND_ENUM_CONSTANT(OBJECT_NODE_PATH_CACHE_MISSES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 
 	BIND_ENUM_CONSTANT(MONITOR_TYPE_QUANTITY);
@@ -152,6 +156,14 @@ int Performance::_get_node_count() const {
 	return sml->get_node_count();
 }
 
+int Performance::_get_pooled_instance_count() const {
+	SceneTree *sml = Object::cast_to<SceneTree>(OS::get_singleton()->get_main_loop());
+	if (!sml) {
+		return 0;
+	}
+	return sml->get_pooled_instance_count(Ref<PackedScene>());
+}
+
 int Performance::_get_orphan_node_count() const {
 #ifdef DEBUG_ENABLED
 	const int total_node_count = Node::total_node_count.get();
@@ -230,6 +242,9 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+		PNAME("object/pooled_instances"),
+		PNAME("object/node_path_cache_hits"),
+		PNAME("object/node_path_cache_misses"),
 	};
 	static_assert(std_size(names) == MONITOR_MAX);
 
@@ -262,6 +277,12 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return _get_node_count();
 		case OBJECT_ORPHAN_NODE_COUNT:
 			return _get_orphan_node_count();
+		case OBJECT_POOLED_INSTANCE_COUNT:
+			return _get_pooled_instance_count();
+		case OBJECT_NODE_PATH_CACHE_HITS:
+			return Node::get_node_path_cache_hits();
+		case OBJECT_NODE_PATH_CACHE_MISSES:
+			return Node::get_node_path_cache_misses();
 		case RENDER_TOTAL_OBJECTS_IN_FRAME:
 			return RS::get_singleton()->get_rendering_info(RSE::RENDERING_INFO_TOTAL_OBJECTS_IN_FRAME);
 		case RENDER_TOTAL_PRIMITIVES_IN_FRAME:
@@ -527,6 +548,9 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 #endif // _3D_DISABLED
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
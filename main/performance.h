@@ -53,6 +53,7 @@ class Performance : public Object {
 
 	int _get_node_count() const;
 	int _get_orphan_node_count() const;
+	int _get_pooled_instance_count() const;
 
 	double _process_time;
 	double _physics_process_time;
@@ -122,6 +123,9 @@ public:
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
 #endif // _3D_DISABLED
+		OBJECT_POOLED_INSTANCE_COUNT,
+		OBJECT_NODE_PATH_CACHE_HITS,
+		OBJECT_NODE_PATH_CACHE_MISSES,
 		MONITOR_MAX
 	};
 
@@ -97,6 +97,8 @@ complete -c godot -l disable-render-loop -d "Disable render loop so rendering on
 complete -c godot -l disable-crash-handler -d "Disable crash handler when supported by the platform code"
 complete -c godot -l fixed-fps -d "Force a fixed number of frames per second (this setting disables real-time synchronization)" -x
 complete -c godot -l print-fps -d "Print the frames per second to the stdout"
+complete -c godot -l profile-resource-loading -d "Record the timing of every resource load and save it to a given file in Chrome trace JSON format" -x
+complete -c godot -l profile-nodes -d "Print the nodes and scenes that spend the most time in process callbacks about once per second" -x
 
 # Standalone tools:
 complete -c godot -s s -l script -d "Run a script" -r
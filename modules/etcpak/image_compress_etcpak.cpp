@@ -90,6 +90,68 @@ void _compress_bc(Image *r_img, Image::UsedChannels p_channels) {
 	_compress_etcpak(_determine_dxt_type(p_channels), r_img);
 }
 
+struct EtcpakBlockRows {
+	EtcpakType type = EtcpakType::ETCPAK_TYPE_ETC1;
+	const uint32_t *src = nullptr;
+	uint64_t *dst = nullptr;
+	uint32_t width = 0;
+};
+
+static void _compress_etcpak_block_rows(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	const EtcpakBlockRows *rows = static_cast<const EtcpakBlockRows *>(p_userdata);
+	const uint32_t blocks_per_row = rows->width / 4;
+	const uint32_t blocks = (p_to - p_from) * blocks_per_row;
+	const uint32_t *src = rows->src + p_from * 4 * rows->width;
+
+	// Formats with alpha or two channels use 16 bytes per block, the others 8.
+	uint64_t *dst_8 = rows->dst + p_from * blocks_per_row;
+	uint64_t *dst_16 = rows->dst + p_from * blocks_per_row * 2;
+
+	switch (rows->type) {
+		case EtcpakType::ETCPAK_TYPE_ETC1:
+			CompressEtc1RgbDither(src, dst_8, blocks, rows->width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2:
+			CompressEtc2Rgb(src, dst_8, blocks, rows->width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
+		case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
+			CompressEtc2Rgba(src, dst_16, blocks, rows->width, true);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_R:
+			CompressEacR(src, dst_8, blocks, rows->width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_ETC2_RG:
+			CompressEacRg(src, dst_16, blocks, rows->width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT1:
+			CompressBc1Dither(src, dst_8, blocks, rows->width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_DXT5:
+		case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
+			CompressBc3(src, dst_16, blocks, rows->width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_R:
+			CompressBc4(src, dst_8, blocks, rows->width);
+			break;
+
+		case EtcpakType::ETCPAK_TYPE_RGTC_RG:
+			CompressBc5(src, dst_16, blocks, rows->width);
+			break;
+
+		default:
+			ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
+			break;
+	}
+}
+
 void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 	uint64_t start_time = OS::get_singleton()->get_ticks_msec();
 
@@ -216,7 +278,6 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 		// Block size.
 		dest_mip_w = (dest_mip_w + 3) & ~3;
 		dest_mip_h = (dest_mip_h + 3) & ~3;
-		const uint32_t blocks = dest_mip_w * dest_mip_h / 16;
 
 		// Get mip data from source image for reading.
 		int64_t src_mip_ofs, src_mip_size;
@@ -255,49 +316,13 @@ void _compress_etcpak(EtcpakType p_compress_type, Image *r_img) {
 			src_mip_read = padded_src.ptr();
 		}
 
-		switch (p_compress_type) {
-			case EtcpakType::ETCPAK_TYPE_ETC1:
-				CompressEtc1RgbDither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2:
-				CompressEtc2Rgb(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_ALPHA:
-			case EtcpakType::ETCPAK_TYPE_ETC2_RA_AS_RG:
-				CompressEtc2Rgba(src_mip_read, dest_mip_write, blocks, dest_mip_w, true);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_R:
-				CompressEacR(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_ETC2_RG:
-				CompressEacRg(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT1:
-				CompressBc1Dither(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_DXT5:
-			case EtcpakType::ETCPAK_TYPE_DXT5_RA_AS_RG:
-				CompressBc3(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_R:
-				CompressBc4(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			case EtcpakType::ETCPAK_TYPE_RGTC_RG:
-				CompressBc5(src_mip_read, dest_mip_write, blocks, dest_mip_w);
-				break;
-
-			default:
-				ERR_FAIL_MSG("etcpak: Invalid or unsupported compression format.");
-				break;
-		}
+		// Rows of blocks are independent, so encode them in parallel straight into the destination.
+		EtcpakBlockRows block_rows;
+		block_rows.type = p_compress_type;
+		block_rows.src = src_mip_read;
+		block_rows.dst = dest_mip_write;
+		block_rows.width = dest_mip_w;
+		Image::compress_block_rows(dest_mip_h / 4, dest_mip_w / 4, &_compress_etcpak_block_rows, &block_rows);
 	}
 
 	// Replace original image with compressed one.
@@ -109,34 +109,65 @@ void Node3D::_propagate_transform_changed_deferred() {
 	}
 }
 
-void Node3D::_propagate_transform_changed(Node3D *p_origin) {
+bool Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	if (!is_inside_tree()) {
-		return;
+		return false;
+	}
+
+	// If this subtree was already dirtied and queued since notifications were last flushed, and nothing has
+	// read a global transform from it since, walking it again would change nothing. This keeps repeated
+	// changes on deep hierarchies (e.g. animated parents and children) from re-walking the same branches.
+	const bool single_threaded = !is_group_processing();
+	const uint32_t epoch = get_tree()->xform_change_epoch;
+	if (single_threaded && data.xform_propagated_epoch == epoch && (data.dirty.st & (DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM)) == (DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM)) {
+		return true;
 	}
 
+	// Whether every node of this subtree that wants NOTIFICATION_TRANSFORM_CHANGED is queued.
+	bool queued = true;
+
 	for (uint32_t n = 0; n < data.node3d_children.size(); n++) {
 		Node3D *s = data.node3d_children[n];
 
 		// Don't propagate to a toplevel.
 		if (!s->data.top_level) {
-			s->_propagate_transform_changed(p_origin);
+			queued = s->_propagate_transform_changed(p_origin) && queued;
 		}
 	}
 
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+	if (!data.gizmos.is_empty() || data.notify_transform) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+	if (data.notify_transform) {
 #endif
-		// SceneTree::xform_change_list is not thread safe to modify, and is read by the main thread when processings are done.
-		if (Thread::is_main_thread()) {
-			get_tree()->xform_change_list.add(&xform_change);
+		if (xform_change.in_list()) {
+			// Already queued.
+		} else if (data.ignore_notification) {
+			// Not queued, so a later change must walk this node again.
+			queued = false;
 		} else {
-			// For any threaded-processed node, add it to xform_change_list on the main thread in a deferred manner.
-			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
+			// SceneTree::xform_change_list is not thread safe to modify, and is read by the main thread when processings are done.
+			if (Thread::is_main_thread()) {
+				get_tree()->xform_change_list.add(&xform_change);
+			} else {
+				// For any threaded-processed node, add it to xform_change_list on the main thread in a deferred manner.
+				callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
+				queued = false;
+			}
 		}
 	}
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
+
+	if (single_threaded && queued) {
+		data.xform_propagated_epoch = epoch;
+	}
+	return queued;
+}
+
+void Node3D::_invalidate_propagated_subtrees() {
+	if (is_inside_tree()) {
+		get_tree()->xform_change_epoch++;
+	}
 }
 
 void Node3D::_notification(int p_what) {
@@ -178,6 +209,7 @@ void Node3D::_notification(int p_what) {
 
 			_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM); // Global is always dirty upon entering a scene.
 			_notify_dirty();
+			_invalidate_propagated_subtrees(); // Ancestors may have been propagated without this node.
 
 			notification(NOTIFICATION_ENTER_WORLD);
 			_update_visibility_parent(true);
@@ -913,6 +945,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_propagated_subtrees();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -1053,6 +1086,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 		}
 	}
 	data.top_level = p_enabled;
+	_invalidate_propagated_subtrees();
 	reset_physics_interpolation();
 }
 
@@ -1062,6 +1096,7 @@ void Node3D::set_as_top_level_keep_local(bool p_enabled) {
 		return;
 	}
 	data.top_level = p_enabled;
+	_invalidate_propagated_subtrees();
 	_propagate_transform_changed(this);
 	reset_physics_interpolation();
 }
@@ -1272,6 +1307,7 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
 	data.notify_transform = p_enabled;
+	_invalidate_propagated_subtrees();
 }
 
 bool Node3D::is_transform_notification_enabled() const {
@@ -1296,6 +1332,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_propagated_subtrees();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
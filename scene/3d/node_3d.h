@@ -123,6 +123,9 @@ private:
 
 		mutable MTNumeric<uint32_t> dirty;
 
+		// SceneTree::xform_change_epoch at the time this subtree was last fully dirtied and queued for notifications.
+		uint32_t xform_propagated_epoch = 0;
+
 		Viewport *viewport = nullptr;
 
 		bool top_level : 1;
@@ -181,7 +184,8 @@ private:
 
 	void _update_gizmos();
 	void _notify_dirty();
-	void _propagate_transform_changed(Node3D *p_origin);
+	bool _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_propagated_subtrees();
 
 	void _propagate_visibility_changed();
 
@@ -48,6 +48,7 @@
 #include "scene/2d/camera_2d.h"
 #include "scene/debugger/scene_debugger_object.h"
 #include "scene/main/node.h"
+#include "scene/main/node_profiler.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
@@ -61,7 +62,33 @@
 #endif
 
 #ifdef DEBUG_ENABLED
+#include "core/debugger/engine_profiler.h"
 #include "scene/debugger/runtime_node_select.h"
+
+// Sends the most expensive nodes and scenes as "nodes:profile_frame" messages.
+// Options are `[count, interval]`, see NodeProfiler.
+class SceneDebugger::NodesProfiler : public EngineProfiler {
+public:
+	void toggle(bool p_enable, const Array &p_opts) override {
+		if (p_enable) {
+			const int count = p_opts.size() > 0 ? int(p_opts[0]) : 10;
+			const int interval = p_opts.size() > 1 ? int(p_opts[1]) : 1;
+			NodeProfiler::start(MAX(1, count), MAX(1, interval), false);
+		} else {
+			NodeProfiler::stop();
+		}
+	}
+
+	void tick(double p_frame_time, double p_process_time, double p_physics_time, double p_physics_frame_time) override {
+		if (!NodeProfiler::is_enabled() || NodeProfiler::get_sampled_frames() == 0) {
+			return;
+		}
+		EngineDebugger::get_singleton()->send_message("nodes:profile_frame", NodeProfiler::get_top_costs());
+		if (!NodeProfiler::is_printing()) {
+			NodeProfiler::reset(); // Otherwise costs accumulate until printed.
+		}
+	}
+};
 #endif
 
 SceneDebugger::SceneDebugger() {
@@ -72,11 +99,19 @@ SceneDebugger::SceneDebugger() {
 	RuntimeNodeSelect::singleton = memnew(RuntimeNodeSelect);
 
 	EngineDebugger::register_message_capture("scene", EngineDebugger::Capture(nullptr, SceneDebugger::parse_message));
+
+	nodes_profiler.instantiate();
+	nodes_profiler->bind("nodes");
 #endif
 }
 
 SceneDebugger::~SceneDebugger() {
 #ifdef DEBUG_ENABLED
+	if (nodes_profiler.is_valid()) {
+		nodes_profiler->unbind();
+		nodes_profiler.unref();
+	}
+
 	if (LiveEditor::singleton) {
 		EngineDebugger::unregister_message_capture("scene");
 		memdelete(LiveEditor::singleton);
@@ -52,6 +52,9 @@ public:
 
 #ifdef DEBUG_ENABLED
 private:
+	class NodesProfiler;
+	Ref<NodesProfiler> nodes_profiler;
+
 	static void _handle_input(const Ref<InputEvent> &p_event, const Ref<Shortcut> &p_shortcut);
 	static void _handle_embed_input(const Ref<InputEvent> &p_event, const Dictionary &p_settings);
 	static void _on_window_size_changed();
@@ -292,6 +292,10 @@ void Node::_notification(int p_notification) {
 				return;
 			}
 #endif
+			if (data.pooled && SceneTree::get_singleton()) {
+				SceneTree::get_singleton()->_pooled_instance_freed(this);
+			}
+
 			if (data.owner) {
 				_clean_up_owner();
 			}
@@ -447,9 +451,7 @@ void Node::_propagate_exit_tree() {
 
 	data.viewport = nullptr;
 
-	if (data.tree) {
-		data.tree->tree_changed();
-	}
+	// SceneTree::tree_changed is emitted once for the whole branch by _set_tree().
 
 	data.ready_notified = false;
 	data.tree = nullptr;
@@ -1434,6 +1436,7 @@ StringName Node::get_name() const {
 
 void Node::_set_name_nocheck(const StringName &p_name) {
 	data.name = p_name;
+	_invalidate_node_paths();
 }
 
 void Node::set_name(const StringName &p_name) {
@@ -1455,6 +1458,8 @@ void Node::set_name(const StringName &p_name) {
 		}
 	}
 
+	_invalidate_node_paths();
+
 	if (data.parent) {
 		data.parent->_validate_child_name(this, true);
 		bool success = data.parent->data.children.replace_key(old_name, data.name);
@@ -1661,11 +1666,10 @@ Node::InternalMode Node::get_internal_mode() const {
 	return data.internal_mode;
 }
 
-void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
-	//add a child node quickly, without name validation
-
+void Node::_link_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode) {
 	p_child->data.name = p_name;
 	data.children.insert(p_name, p_child);
+	_invalidate_node_paths();
 
 	p_child->data.internal_mode = p_internal_mode;
 
@@ -1695,11 +1699,17 @@ void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalM
 	} else {
 		data.children_cache_dirty = true;
 	}
+}
+
+void Node::_add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode, bool p_propagate_ready) {
+	//add a child node quickly, without name validation
+
+	_link_child_nocheck(p_child, p_name, p_internal_mode);
 
 	p_child->notification(NOTIFICATION_PARENTED);
 
 	if (data.tree) {
-		p_child->_set_tree(data.tree);
+		p_child->_set_tree(data.tree, p_propagate_ready);
 	}
 
 	/* Notify */
@@ -1732,6 +1742,47 @@ void Node::add_child(RequiredParam<Node> rp_child, bool p_force_readable_name, I
 	_add_child_nocheck(p_child, p_child->data.name, p_internal);
 }
 
+void Node::_unlink_children(LocalVector<Node *> &r_children) {
+	// Children outside the tree are detached silently, and given back to
+	// this node with _relink_child() once it has entered the tree. They are
+	// listed in the order they would have entered the tree, and keep their
+	// index to get their position among siblings back.
+	ERR_FAIL_COND(data.tree);
+
+	r_children.reserve(r_children.size() + data.children.size());
+	for (KeyValue<StringName, Node *> &K : data.children) {
+		K.value->data.parent = nullptr;
+		K.value->_invalidate_node_paths(); // Paths leaving its branch now start from a new root.
+		r_children.push_back(K.value);
+	}
+
+	data.children.clear();
+	data.children_cache.clear();
+	data.children_cache_dirty = false;
+	data.internal_children_front_count_cache = 0;
+	data.internal_children_back_count_cache = 0;
+	data.external_children_count_cache = 0;
+	_invalidate_node_paths();
+}
+
+void Node::_relink_child(Node *p_child) {
+	ERR_FAIL_COND(p_child->data.parent);
+
+	// Siblings may have been added in the meantime.
+	_validate_child_name(p_child);
+
+	int index = p_child->data.index;
+	_link_child_nocheck(p_child, p_child->data.name, p_child->data.internal_mode);
+	if (index >= 0 && p_child->data.index != index) {
+		p_child->data.index = index;
+		data.children_cache_dirty = true;
+	}
+
+	if (data.tree) {
+		p_child->_set_tree(data.tree);
+	}
+}
+
 void Node::add_sibling(RequiredParam<Node> rp_sibling, bool p_force_readable_name) {
 	ERR_FAIL_COND_MSG(data.tree && !Thread::is_main_thread(), "Adding a sibling to a node inside the SceneTree is only allowed from the main thread. Use call_deferred(\"add_sibling\",node).");
 	EXTRACT_PARAM_OR_FAIL(p_sibling, rp_sibling);
@@ -1789,9 +1840,11 @@ void Node::remove_child(RequiredParam<Node> rp_child) {
 	}
 	bool success = data.children.erase(p_child->data.name);
 	ERR_FAIL_COND_MSG(!success, "Children name does not match parent name in hashtable, this is a bug.");
+	_invalidate_node_paths();
 
 	p_child->data.parent = nullptr;
 	p_child->data.index = -1;
+	p_child->_invalidate_node_paths(); // Paths leaving its branch now start from a new root.
 
 	notification(NOTIFICATION_CHILD_ORDER_CHANGED);
 	emit_signal(SNAME("child_order_changed"));
@@ -1919,6 +1972,67 @@ Node *Node::_get_child_by_name(const StringName &p_name) const {
 	}
 }
 
+void Node::_invalidate_node_paths() {
+	// Paths only resolve through this node from this node or one of its ancestors, so the
+	// rest of the tree keeps its cached paths.
+	const uint64_t version = node_path_version.increment();
+	for (Node *node = this; node; node = node->data.parent) {
+		node->data.node_path_version = version;
+	}
+}
+
+uint64_t Node::_get_node_path_version(const NodePath &p_path) const {
+	bool in_branch = !p_path.is_absolute();
+	for (int i = 0; in_branch && i < p_path.get_name_count(); i++) {
+		const StringName &name = p_path.get_name(i);
+		in_branch = name != SNAME("..") && !name.is_node_unique_name();
+	}
+	if (in_branch) {
+		return data.node_path_version;
+	}
+
+	// Paths leaving this branch, or going through an owner, can change with anything in the tree.
+	const Node *root = this;
+	while (root->data.parent) {
+		root = root->data.parent;
+	}
+	return root->data.node_path_version;
+}
+
+Node *Node::_get_cached_node_path(const NodePath &p_path, uint64_t p_version) const {
+	NodePathCache *cache = data.node_path_cache;
+	if (!cache) {
+		return nullptr;
+	}
+	for (uint32_t i = 0; i < NodePathCache::SIZE; i++) {
+		if (cache->versions[i] == p_version && cache->nodes[i].is_valid() && cache->paths[i] == p_path) {
+			// The version covers any change to the path, this only guards against freed nodes.
+			return ObjectDB::get_instance<Node>(cache->nodes[i]);
+		}
+	}
+	return nullptr;
+}
+
+void Node::_cache_node_path(const NodePath &p_path, Node *p_node, uint64_t p_version) const {
+	if (!data.node_path_cache) {
+		data.node_path_cache = memnew(NodePathCache);
+	}
+	NodePathCache *cache = data.node_path_cache;
+	uint32_t index = cache->next;
+	for (uint32_t i = 0; i < NodePathCache::SIZE; i++) {
+		if (cache->paths[i] == p_path) {
+			index = i; // Replace the stale entry rather than keeping two for the same path.
+			break;
+		}
+	}
+	if (index == cache->next) {
+		cache->next = (cache->next + 1) % NodePathCache::SIZE;
+	}
+	cache->paths[index] = p_path;
+	cache->nodes[index] = p_node->get_instance_id();
+	cache->versions[index] = p_version;
+}
+
 Node *Node::get_node_or_null(const NodePath &p_path) const {
 	ERR_THREAD_GUARD_V(nullptr);
 	if (p_path.is_empty()) {
@@ -1927,6 +2041,20 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 
 	ERR_FAIL_COND_V_MSG(!data.tree && p_path.is_absolute(), nullptr, "Can't use get_node() with absolute paths from outside the active scene tree.");
 
+	// Paths with a single name take one lookup anyway. Longer ones (such as `$Path/To/Child` in
+	// scripts) take one per name, so remember where they led until the tree structure changes.
+	// Caches are only touched from the main thread, as threaded groups may share nodes.
+	const bool use_cache = p_path.get_name_count() > 1 && Thread::is_main_thread();
+	const uint64_t version = use_cache ? _get_node_path_version(p_path) : 0; // Read before resolving, so a concurrent change can't be missed.
+	if (use_cache) {
+		Node *cached = _get_cached_node_path(p_path, version);
+		if (cached) {
+			node_path_cache_hits++;
+			return cached;
+		}
+		node_path_cache_misses++;
+	}
+
 	Node *current = nullptr;
 	Node *root = nullptr;
 
@@ -1978,6 +2106,10 @@ Node *Node::get_node_or_null(const NodePath &p_path) const {
 		current = next;
 	}
 
+	if (use_cache && current) {
+		_cache_node_path(p_path, current, version);
+	}
+
 	return current;
 }
 
@@ -2245,6 +2377,7 @@ void Node::_set_owner_nocheck(Node *p_owner) {
 	ERR_FAIL_COND(data.owner);
 	data.owner = p_owner;
 	data.owner->data.owned.push_back(this);
+	_invalidate_node_paths(); // Unique names are looked up through the owner.
 	data.OW = data.owner->data.owned.back();
 
 	owner_changed_notify();
@@ -2258,6 +2391,7 @@ void Node::_release_unique_name_in_owner() {
 		return; // Ignore.
 	}
 	data.owner->data.owned_unique_nodes.erase(key);
+	_invalidate_node_paths();
 }
 
 void Node::_acquire_unique_name_in_owner() {
@@ -2272,6 +2406,7 @@ void Node::_acquire_unique_name_in_owner() {
 		return;
 	}
 	data.owner->data.owned_unique_nodes[key] = this;
+	_invalidate_node_paths();
 }
 
 void Node::set_unique_name_in_owner(bool p_enabled) {
@@ -2335,6 +2470,7 @@ void Node::_clean_up_owner() {
 	data.owner->data.owned.erase(data.OW);
 	data.owner = nullptr;
 	data.OW = nullptr;
+	_invalidate_node_paths();
 }
 
 Node *Node::find_common_parent_with(const Node *p_node) const {
@@ -3381,23 +3517,23 @@ Node *Node::get_node_and_resource(const NodePath &p_path, Ref<Resource> &r_res,
 	return node;
 }
 
-void Node::_set_tree(SceneTree *p_tree) {
+void Node::_set_tree(SceneTree *p_tree, bool p_propagate_ready) {
 	SceneTree *tree_changed_a = nullptr;
 	SceneTree *tree_changed_b = nullptr;
 
 	//ERR_FAIL_COND(p_scene && data.parent && !data.parent->data.scene); //nobug if both are null
 
 	if (data.tree) {
-		_propagate_exit_tree();
-
+		// _propagate_exit_tree() clears data.tree, so remember which tree to notify.
 		tree_changed_a = data.tree;
+		_propagate_exit_tree();
 	}
 
 	data.tree = p_tree;
 
 	if (data.tree) {
 		_propagate_enter_tree();
-		if (!data.parent || data.parent->data.ready_notified) { // No parent (root) or parent ready
+		if (p_propagate_ready && (!data.parent || data.parent->data.ready_notified)) { // No parent (root) or parent ready
 			_propagate_ready(); //reverse_notification(NOTIFICATION_READY);
 		}
 
@@ -4153,6 +4289,8 @@ Node::Node() {
 	data.ready_notified = false; // This is a small hack, so if a node is added during _ready() to the tree, it correctly gets the _ready() notification.
 	data.ready_first = true;
 
+	data.pooled = false;
+
 	data.auto_translate_mode = AUTO_TRANSLATE_MODE_INHERIT;
 	data.is_auto_translating = true;
 	data.is_auto_translate_dirty = true;
@@ -4162,6 +4300,9 @@ Node::Node() {
 }
 
 Node::~Node() {
+	if (data.node_path_cache) {
+		memdelete(data.node_path_cache);
+	}
 	data.grouped.clear();
 	data.owned.clear();
 	data.children.clear();
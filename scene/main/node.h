@@ -195,6 +195,27 @@ private:
 		bool operator()(const Node *p_a, const Node *p_b) const { return p_b->data.physics_process_priority == p_a->data.physics_process_priority ? p_b->is_greater_than(p_a) : p_b->data.physics_process_priority > p_a->data.physics_process_priority; }
 	};
 
+	// Remembers the last few multi-name paths resolved by get_node(), each valid while its
+	// version matches the one returned by `_get_node_path_version()`.
+	struct NodePathCache {
+		static constexpr uint32_t SIZE = 4;
+		NodePath paths[SIZE];
+		ObjectID nodes[SIZE];
+		uint64_t versions[SIZE] = {};
+		uint32_t next = 0;
+	};
+
+	// Hands out the versions stored in `Data::node_path_version`. Nodes outside the tree can be
+	// changed from any thread, hence the atomic counter.
+	static inline SafeNumeric<uint64_t> node_path_version{ 1 };
+	static inline uint64_t node_path_cache_hits = 0;
+	static inline uint64_t node_path_cache_misses = 0;
+
+	void _invalidate_node_paths();
+	uint64_t _get_node_path_version(const NodePath &p_path) const;
+	Node *_get_cached_node_path(const NodePath &p_path, uint64_t p_version) const;
+	void _cache_node_path(const NodePath &p_path, Node *p_node, uint64_t p_version) const;
+
 	// This Data struct is to avoid namespace pollution in derived classes.
 	struct Data {
 		String scene_file_path;
@@ -204,6 +225,8 @@ private:
 		Node *parent = nullptr;
 		Node *owner = nullptr;
 		HashMap<StringName, Node *> children;
+		mutable NodePathCache *node_path_cache = nullptr;
+		uint64_t node_path_version = 0; // Changes with anything in this branch that a path could resolve through.
 		mutable bool children_cache_dirty = false;
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
@@ -286,6 +309,8 @@ private:
 		bool ready_notified : 1;
 		bool ready_first : 1;
 
+		bool pooled : 1; // Acquired from a SceneTree instance pool.
+
 		mutable bool is_auto_translating : 1;
 		mutable bool is_auto_translate_dirty : 1;
 
@@ -331,7 +356,7 @@ private:
 
 	friend class SceneTree;
 
-	void _set_tree(SceneTree *p_tree);
+	void _set_tree(SceneTree *p_tree, bool p_propagate_ready = true);
 	void _propagate_pause_notification(bool p_enable);
 	void _propagate_suspend_notification(bool p_enable);
 
@@ -351,6 +376,11 @@ private:
 
 	void _update_children_cache_impl() const;
 
+	// Used by SceneTree::attach_branch() to enter a branch one node at a time.
+	void _link_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode);
+	void _unlink_children(LocalVector<Node *> &r_children);
+	void _relink_child(Node *p_child);
+
 	// Process group management
 	void _add_process_group();
 	void _remove_process_group();
@@ -391,7 +421,7 @@ protected:
 
 	friend class SceneState;
 
-	void _add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode = INTERNAL_MODE_DISABLED);
+	void _add_child_nocheck(Node *p_child, const StringName &p_name, InternalMode p_internal_mode = INTERNAL_MODE_DISABLED, bool p_propagate_ready = true);
 	void _set_owner_nocheck(Node *p_owner);
 	void _set_name_nocheck(const StringName &p_name);
 
@@ -539,6 +569,8 @@ public:
 	bool has_node(const NodePath &p_path) const;
 	Node *get_node(const NodePath &p_path) const;
 	Node *get_node_or_null(const NodePath &p_path) const;
+	static uint64_t get_node_path_cache_hits() { return node_path_cache_hits; }
+	static uint64_t get_node_path_cache_misses() { return node_path_cache_misses; }
 	Node *find_child(const String &p_pattern, bool p_recursive = true, bool p_owned = true) const;
 	TypedArray<Node> find_children(const String &p_pattern, const String &p_type = "", bool p_recursive = true, bool p_owned = true) const;
 	bool has_node_and_resource(const NodePath &p_path) const;
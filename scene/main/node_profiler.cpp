@@ -0,0 +1,159 @@
+/**************************************************************************/
+/*  node_profiler.cpp                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "node_profiler.h"
+
+#include "core/object/object.h"
+#include "scene/main/node.h"
+
+void NodeProfiler::start(uint32_t p_top_count, uint32_t p_sample_interval, bool p_print) {
+	top_count = MAX(1u, p_top_count);
+	sample_interval = MAX(1u, p_sample_interval);
+	print_costs = print_costs || p_print;
+	enabled = true;
+	reset();
+}
+
+void NodeProfiler::stop() {
+	if (print_costs) {
+		return; // Keep printing what was requested on the command line.
+	}
+	enabled = false;
+	reset();
+}
+
+void NodeProfiler::_add_cost(Cost &r_cost, uint64_t p_usec) {
+	r_cost.usec += p_usec;
+	r_cost.max_usec = MAX(r_cost.max_usec, p_usec);
+	r_cost.calls++;
+}
+
+void NodeProfiler::add_samples(const LocalVector<Sample> &p_samples) {
+	for (const Sample &sample : p_samples) {
+		HashMap<ObjectID, Cost>::Iterator E = node_costs.find(sample.node);
+		if (!E) {
+			// Resolve names once per node, the node may be gone by the time costs are reported.
+			const Node *node = ObjectDB::get_instance<Node>(sample.node);
+			if (!node || !node->is_inside_tree()) {
+				continue; // Freed or removed while processing.
+			}
+
+			Cost cost;
+			cost.name = String(node->get_path());
+
+			const Node *scene_root = node->get_scene_file_path().is_empty() ? node->get_owner() : node;
+			if (scene_root == nullptr) {
+				cost.scene = "<no scene>";
+			} else if (!scene_root->get_scene_file_path().is_empty()) {
+				cost.scene = scene_root->get_scene_file_path();
+			} else {
+				cost.scene = String(scene_root->get_path()); // Built at runtime.
+			}
+			E = node_costs.insert(sample.node, cost);
+		}
+
+		_add_cost(E->value, sample.usec);
+
+		HashMap<String, Cost>::Iterator S = scene_costs.find(E->value.scene);
+		if (!S) {
+			Cost cost;
+			cost.name = E->value.scene;
+			S = scene_costs.insert(E->value.scene, cost);
+		}
+		_add_cost(S->value, sample.usec);
+	}
+}
+
+void NodeProfiler::_keep_top(LocalVector<const Cost *> &r_costs) {
+	struct CostSort {
+		_FORCE_INLINE_ bool operator()(const Cost *p_left, const Cost *p_right) const {
+			return p_left->usec > p_right->usec;
+		}
+	};
+
+	r_costs.sort_custom<CostSort>();
+	if (r_costs.size() > top_count) {
+		r_costs.resize(top_count);
+	}
+}
+
+Array NodeProfiler::get_top_costs() {
+	LocalVector<const Cost *> costs;
+	Array result;
+	result.push_back(sampled_frames);
+
+	for (int i = 0; i < 2; i++) {
+		costs.clear();
+		if (i == 0) {
+			for (const KeyValue<ObjectID, Cost> &E : node_costs) {
+				costs.push_back(&E.value);
+			}
+		} else {
+			for (const KeyValue<String, Cost> &E : scene_costs) {
+				costs.push_back(&E.value);
+			}
+		}
+
+		_keep_top(costs);
+
+		Array entries;
+		for (const Cost *cost : costs) {
+			entries.push_back(Array{ cost->name, USEC_TO_SEC(cost->usec), USEC_TO_SEC(cost->max_usec), cost->calls });
+		}
+		result.push_back(entries);
+	}
+	return result;
+}
+
+void NodeProfiler::print_top_costs() {
+	if (!print_costs || sampled_frames == 0) {
+		return;
+	}
+
+	const Array costs = get_top_costs();
+	print_line(vformat("Most expensive nodes over %d sampled frames:", sampled_frames));
+	for (int i = 1; i < costs.size(); i++) {
+		if (i == 2) {
+			print_line(vformat("Most expensive scenes over %d sampled frames:", sampled_frames));
+		}
+		const Array entries = costs[i];
+		for (int j = 0; j < entries.size(); j++) {
+			const Array entry = entries[j];
+			print_line(vformat("\t%.2f msec (max %.2f msec, %d calls)\t%s", double(entry[1]) * 1000.0, double(entry[2]) * 1000.0, int64_t(entry[3]), entry[0]));
+		}
+	}
+	reset();
+}
+
+void NodeProfiler::reset() {
+	node_costs.clear();
+	scene_costs.clear();
+	sampled_frames = 0;
+}
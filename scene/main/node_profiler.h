@@ -0,0 +1,89 @@
+/**************************************************************************/
+/*  node_profiler.h                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/object/object_id.h"
+#include "core/string/ustring.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/variant/array.h"
+
+// Attributes `_process()` and `_physics_process()` time to individual nodes and to the scenes
+// they were instantiated from, for finding runaway entities without attaching the editor.
+// Enabled with the `--profile-nodes <count>[,<interval>]` command line argument, which prints
+// the most expensive nodes and scenes about once per second, or through the "nodes" profiler
+// of EngineDebugger. Only one of every `interval` frames is measured.
+class NodeProfiler {
+public:
+	struct Sample {
+		ObjectID node;
+		uint64_t usec = 0;
+	};
+
+	struct Cost {
+		String name;
+		String scene; // Only used for node costs.
+		uint64_t usec = 0;
+		uint64_t max_usec = 0;
+		uint64_t calls = 0;
+	};
+
+private:
+	static inline bool enabled = false;
+	static inline bool print_costs = false;
+	static inline uint32_t top_count = 10;
+	static inline uint32_t sample_interval = 1;
+
+	// Only accessed from the main thread, SceneTree collects samples per process group first.
+	static inline HashMap<ObjectID, Cost> node_costs;
+	static inline HashMap<String, Cost> scene_costs;
+	static inline uint64_t sampled_frames = 0;
+
+	static void _add_cost(Cost &r_cost, uint64_t p_usec);
+	static void _keep_top(LocalVector<const Cost *> &r_costs);
+
+public:
+	static void start(uint32_t p_top_count, uint32_t p_sample_interval, bool p_print);
+	static void stop();
+	_FORCE_INLINE_ static bool is_enabled() { return enabled; }
+	_FORCE_INLINE_ static bool is_printing() { return print_costs; }
+	_FORCE_INLINE_ static uint64_t get_sampled_frames() { return sampled_frames; }
+	_FORCE_INLINE_ static bool is_sampling_frame(uint64_t p_frame) { return enabled && p_frame % sample_interval == 0; }
+
+	static void add_samples(const LocalVector<Sample> &p_samples);
+	static void frame_sampled() { sampled_frames++; }
+
+	// Returns `[sampled_frames, nodes, scenes]`, where nodes and scenes are arrays of
+	// `[name, total_seconds, max_seconds, calls]` sorted from most to least expensive.
+	static Array get_top_costs();
+	static void print_top_costs();
+	static void reset();
+};
@@ -34,6 +34,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, RenderingServer);
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/debugger/engine_debugger.h"
 #include "core/input/input.h"
 #include "core/io/image_loader.h"
 #include "core/io/resource_loader.h"
@@ -54,6 +55,7 @@ STATIC_ASSERT_INCOMPLETE_TYPE(class, RenderingServer);
 #include "scene/resources/material.h"
 #include "scene/resources/mesh.h"
 #include "scene/resources/packed_scene.h"
+#include "scene/resources/texture_streamer.h"
 #include "scene/resources/world_2d.h"
 #include "servers/display/accessibility_server.h"
 #include "servers/display/display_server.h"
@@ -179,10 +181,23 @@ SceneTreeGroup *SceneTree::add_to_group(const StringName &p_group, Node *p_node)
 		E = group_map.insert(p_group, SceneTreeGroup());
 	}
 
-	ERR_FAIL_COND_V_MSG(E->value.nodes.has(p_node), &E->value, "Already in group: " + p_group + ".");
-	E->value.nodes.push_back(p_node);
-	E->value.changed = true;
-	return &E->value;
+	SceneTreeGroup &g = E->value;
+	if (g.changed) {
+		ERR_FAIL_COND_V_MSG(g.nodes.has(p_node), &g, "Already in group: " + p_group + ".");
+		g.nodes.push_back(p_node);
+		return &g;
+	}
+
+	// Keep the group in tree order as it grows, new nodes usually come after all the others.
+	const int count = g.nodes.size();
+	if (count == 0 || Node::Comparator()(g.nodes[count - 1], p_node)) {
+		g.nodes.push_back(p_node);
+	} else {
+		const int pos = _find_group_position(g, p_node);
+		ERR_FAIL_COND_V_MSG(pos < count && g.nodes[pos] == p_node, &g, "Already in group: " + p_group + ".");
+		g.nodes.insert(pos, p_node);
+	}
+	return &g;
 }
 
 void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
@@ -191,15 +206,52 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 	HashMap<StringName, SceneTreeGroup>::Iterator E = group_map.find(p_group);
 	ERR_FAIL_COND(!E);
 
-	E->value.nodes.erase(p_node);
-	if (E->value.nodes.is_empty()) {
+	SceneTreeGroup &g = E->value;
+	// Branches exit the tree in reverse tree order, and streamed branches are usually the last ones
+	// added, so their nodes mostly leave groups from the back.
+	const int count = g.nodes.size();
+	int pos = -1;
+	if (count > 0 && g.nodes[count - 1] == p_node) {
+		pos = count - 1;
+	} else if (!g.changed) {
+		pos = _find_group_position(g, p_node);
+		if (pos >= count || g.nodes[pos] != p_node) {
+			pos = -1;
+		}
+	}
+	if (pos < 0) {
+		pos = g.nodes.rfind(p_node);
+	}
+	if (pos >= 0) {
+		g.nodes.remove_at(pos);
+	}
+
+	if (g.nodes.is_empty()) {
 		group_map.remove(E);
 	}
 }
 
+int SceneTree::_find_group_position(const SceneTreeGroup &p_group, const Node *p_node) const {
+	// First node not before `p_node` in tree order.
+	const Node *const *nodes = p_group.nodes.ptr();
+	int lo = 0;
+	int hi = p_group.nodes.size();
+	while (lo < hi) {
+		const int mid = (lo + hi) / 2;
+		if (Node::Comparator()(nodes[mid], p_node)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	xform_change_epoch++;
+
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -393,7 +445,9 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			return;
 		}
 
-		_update_group_order(g);
+		if (!(p_call_flags & GROUP_CALL_UNORDERED)) {
+			_update_group_order(g);
+		}
 		nodes_copy = g.nodes;
 	}
 
@@ -464,7 +518,9 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 			return;
 		}
 
-		_update_group_order(g);
+		if (!(p_call_flags & GROUP_CALL_UNORDERED)) {
+			_update_group_order(g);
+		}
 
 		nodes_copy = g.nodes;
 	}
@@ -527,7 +583,9 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 			return;
 		}
 
-		_update_group_order(g);
+		if (!(p_call_flags & GROUP_CALL_UNORDERED)) {
+			_update_group_order(g);
+		}
 
 		nodes_copy = g.nodes;
 	}
@@ -583,6 +641,130 @@ void SceneTree::set_group(const StringName &p_group, const String &p_name, const
 	set_group_flags(GROUP_CALL_DEFAULT, p_group, p_name, p_value);
 }
 
+// Sets one element per node. Setters are resolved once per run of nodes sharing a class, and called
+// with ptrcall straight from the element when the setter argument is of type `p_ptrcall_type`
+// (converted to `A`, the type ptrcall expects). Anything else goes through Variant calls.
+template <typename T, typename A = T>
+static int _set_nodes_property(const PackedInt64Array &p_node_ids, const StringName &p_property, const T *p_values, int64_t p_value_count, Variant::Type p_ptrcall_type) {
+	ERR_FAIL_COND_V_MSG(p_value_count != p_node_ids.size(), 0, vformat("Got %d values for %d nodes, expected one value per node.", p_value_count, p_node_ids.size()));
+
+	StringName cached_class;
+	const ClassDB::PropertySetGet *setter = nullptr;
+	bool use_ptrcall = false;
+	int set_count = 0;
+
+	const int64_t *ids = p_node_ids.ptr();
+	for (int i = 0; i < p_node_ids.size(); i++) {
+		Node *node = ObjectDB::get_instance<Node>(ObjectID(ids[i]));
+		ERR_CONTINUE_MSG(!node, vformat("Node instance ID %d is not a valid node.", ids[i]));
+
+		const StringName &class_name = node->get_class_name();
+		if (class_name != cached_class) {
+			cached_class = class_name;
+			// Extension classes may handle the property in their own `_set()`, let Object::set() decide.
+			setter = ClassDB::is_gdextension(class_name) ? nullptr : ClassDB::get_property_setget(class_name, p_property);
+			if (setter && !setter->_setptr) {
+				setter = nullptr;
+			}
+
+			use_ptrcall = false;
+			if (setter && p_ptrcall_type != Variant::NIL && !setter->_setptr->is_vararg()) {
+				const int value_arg = setter->index >= 0 ? 1 : 0;
+				use_ptrcall = setter->_setptr->get_argument_count() == value_arg + 1 && setter->_setptr->get_argument_type(value_arg) == p_ptrcall_type;
+			}
+		}
+
+		if (node->get_script_instance()) {
+			// Scripts may handle the property themselves.
+			bool valid = false;
+			node->set(p_property, p_values[i], &valid);
+			set_count += valid ? 1 : 0;
+		} else if (use_ptrcall) {
+			const A value = A(p_values[i]);
+			if (setter->index >= 0) {
+				const int64_t index = setter->index;
+				const void *args[2] = { &index, &value };
+				setter->_setptr->ptrcall(node, args, nullptr);
+			} else {
+				const void *args[1] = { &value };
+				setter->_setptr->ptrcall(node, args, nullptr);
+			}
+			set_count++;
+		} else if (setter) {
+			const Variant value = p_values[i];
+			Callable::CallError ce;
+			if (setter->index >= 0) {
+				const Variant index = setter->index;
+				const Variant *args[2] = { &index, &value };
+				setter->_setptr->call(node, args, 2, ce);
+			} else {
+				const Variant *args[1] = { &value };
+				setter->_setptr->call(node, args, 1, ce);
+			}
+			set_count += ce.error == Callable::CallError::CALL_OK ? 1 : 0;
+		} else {
+			bool valid = false;
+			node->set(p_property, p_values[i], &valid);
+			set_count += valid ? 1 : 0;
+		}
+	}
+
+	return set_count;
+}
+
+int SceneTree::set_nodes_property(const PackedInt64Array &p_node_ids, const StringName &p_property, const Variant &p_values) {
+	switch (p_values.get_type()) {
+		case Variant::PACKED_INT32_ARRAY: {
+			const PackedInt32Array values = p_values;
+			return _set_nodes_property<int32_t, int64_t>(p_node_ids, p_property, values.ptr(), values.size(), Variant::INT);
+		}
+		case Variant::PACKED_INT64_ARRAY: {
+			const PackedInt64Array values = p_values;
+			return _set_nodes_property<int64_t>(p_node_ids, p_property, values.ptr(), values.size(), Variant::INT);
+		}
+		case Variant::PACKED_FLOAT32_ARRAY: {
+			const PackedFloat32Array values = p_values;
+			return _set_nodes_property<float, double>(p_node_ids, p_property, values.ptr(), values.size(), Variant::FLOAT);
+		}
+		case Variant::PACKED_FLOAT64_ARRAY: {
+			const PackedFloat64Array values = p_values;
+			return _set_nodes_property<double>(p_node_ids, p_property, values.ptr(), values.size(), Variant::FLOAT);
+		}
+		case Variant::PACKED_STRING_ARRAY: {
+			const PackedStringArray values = p_values;
+			return _set_nodes_property<String>(p_node_ids, p_property, values.ptr(), values.size(), Variant::STRING);
+		}
+		case Variant::PACKED_VECTOR2_ARRAY: {
+			const PackedVector2Array values = p_values;
+			return _set_nodes_property<Vector2>(p_node_ids, p_property, values.ptr(), values.size(), Variant::VECTOR2);
+		}
+		case Variant::PACKED_VECTOR3_ARRAY: {
+			const PackedVector3Array values = p_values;
+			return _set_nodes_property<Vector3>(p_node_ids, p_property, values.ptr(), values.size(), Variant::VECTOR3);
+		}
+		case Variant::PACKED_COLOR_ARRAY: {
+			const PackedColorArray values = p_values;
+			return _set_nodes_property<Color>(p_node_ids, p_property, values.ptr(), values.size(), Variant::COLOR);
+		}
+		case Variant::PACKED_VECTOR4_ARRAY: {
+			const PackedVector4Array values = p_values;
+			return _set_nodes_property<Vector4>(p_node_ids, p_property, values.ptr(), values.size(), Variant::VECTOR4);
+		}
+		case Variant::ARRAY: {
+			const Array values = p_values;
+			LocalVector<Variant> elements;
+			elements.resize(values.size());
+			for (int i = 0; i < values.size(); i++) {
+				elements[i] = values[i];
+			}
+			return _set_nodes_property<Variant>(p_node_ids, p_property, elements.ptr(), elements.size(), Variant::NIL);
+		}
+		default: {
+			ERR_FAIL_V_MSG(0, "Values must be an Array or a packed array.");
+		}
+	}
+}
+
 void SceneTree::initialize() {
 	GodotProfileZone("SceneTree::initialize");
 	ERR_FAIL_NULL(root);
@@ -662,6 +844,8 @@ bool SceneTree::physics_process(double p_time) {
 
 	flush_transform_notifications();
 
+	_flush_pool_release_queue();
+
 	// This should happen last because any processing that deletes something beforehand might expect the object to be removed in the same frame.
 	_flush_delete_queue();
 
@@ -694,6 +878,7 @@ bool SceneTree::process(double p_time) {
 		// If this is not done, we can end up with a deferred `set_transform()`
 		// overwriting the interpolated xform in the server.
 		flush_transform_notifications();
+		xform_change_epoch++; // Interpolated dirty flags are cleared by the frame update.
 		get_scene_tree_fti().frame_update(get_root(), true);
 	}
 
@@ -731,6 +916,10 @@ bool SceneTree::process(double p_time) {
 
 	flush_transform_notifications(); // Additional transforms after timers update.
 
+	_flush_pool_release_queue();
+
+	_process_branch_attaches();
+
 	// This should happen last because any processing that deletes something beforehand might expect the object to be removed in the same frame.
 	_flush_delete_queue();
 
@@ -738,6 +927,8 @@ bool SceneTree::process(double p_time) {
 
 	_call_idle_callbacks();
 
+	TextureStreamer::process();
+
 #ifdef TOOLS_ENABLED
 #ifndef _3D_DISABLED
 	if (Engine::get_singleton()->is_editor_hint()) {
@@ -781,6 +972,7 @@ bool SceneTree::process(double p_time) {
 	// Second pass of scene tree fixed timestep interpolation.
 	// ToDo: Possibly needs another flush_transform_notifications here
 	// depending on whether there are side effects to _call_idle_callbacks().
+	xform_change_epoch++;
 	get_scene_tree_fti().frame_update(get_root(), false);
 
 	if (_physics_interpolation_enabled) {
@@ -855,8 +1047,22 @@ void SceneTree::process_tweens(double p_delta, bool p_physics) {
 void SceneTree::finalize() {
 	_flush_delete_queue();
 
+	clear_instance_pool(Ref<PackedScene>());
+	_flush_pool_release_queue();
+
 	_flush_ugc();
 
+	// Nodes still waiting to be attached are not part of the tree, so free them here.
+	for (const BranchAttach &attach : branch_attaches) {
+		for (const BranchAttach::Pending &pending : attach.pending) {
+			Node *node = ObjectDB::get_instance<Node>(pending.node);
+			if (node && !node->get_parent()) {
+				memdelete(node);
+			}
+		}
+	}
+	branch_attaches.clear();
+
 	if (root) {
 		root->_set_tree(nullptr);
 		root->_propagate_after_exit_tree();
@@ -1215,6 +1421,10 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			continue;
 		}
 
+		// The node may free itself while processing, so keep what is needed to report it.
+		const ObjectID node_id = node_profiling ? n->get_instance_id() : ObjectID();
+		const uint64_t node_from = node_profiling ? OS::get_singleton()->get_ticks_usec() : 0;
+
 		if (p_physics) {
 			if (n->is_physics_processing_internal()) {
 				n->notification(Node::NOTIFICATION_INTERNAL_PHYSICS_PROCESS);
@@ -1230,17 +1440,69 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 				n->notification(Node::NOTIFICATION_PROCESS);
 			}
 		}
+
+		if (node_profiling) {
+			NodeProfiler::Sample sample;
+			sample.node = node_id;
+			sample.usec = OS::get_singleton()->get_ticks_usec() - node_from;
+			p_group->node_profile_samples.push_back(sample);
+		}
 	}
 
 	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
 }
 
+void SceneTree::_process_group_timed(ProcessGroup *p_group, bool p_physics) {
+#ifdef DEBUG_ENABLED
+	if (process_groups_profiling) {
+		// Each group is processed by a single thread, so its timer needs no synchronization.
+		uint64_t from = OS::get_singleton()->get_ticks_usec();
+		_process_group(p_group, p_physics);
+		p_group->profile_usec = OS::get_singleton()->get_ticks_usec() - from;
+		return;
+	}
+#endif
+	_process_group(p_group, p_physics);
+}
+
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
 	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	_process_group_timed(local_process_group_cache[p_index], p_physics);
 	Node::current_process_thread_group = nullptr;
 }
 
+#ifdef DEBUG_ENABLED
+void SceneTree::_add_process_group_profile_data(uint32_t p_group_count, bool p_physics) {
+	Array values;
+	values.push_back(p_physics ? "physics_process_groups" : "process_groups");
+
+	for (uint32_t i = 0; i < p_group_count; i++) {
+		ProcessGroup *pg = process_groups[i];
+		if (pg->removed || pg->last_pass != process_last_pass) {
+			continue;
+		}
+
+		String name;
+		if (pg->owner == nullptr) {
+			name = "main_thread";
+		} else if (pg->owner->is_inside_tree()) {
+			name = String(pg->owner->get_path());
+		} else {
+			name = pg->owner->get_name();
+		}
+		if (pg->owner != nullptr && pg->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled) {
+			name += " (sub_thread)";
+		}
+
+		values.push_back(name);
+		values.push_back(USEC_TO_SEC(pg->profile_usec));
+		pg->profile_usec = 0;
+	}
+
+	EngineDebugger::profiler_add_frame_data("servers", values);
+}
+#endif
+
 void SceneTree::_process(bool p_physics) {
 	if (process_groups_dirty) {
 		{
@@ -1280,6 +1542,10 @@ void SceneTree::_process(bool p_physics) {
 	}
 
 	process_last_pass++; // Increment pass
+#ifdef DEBUG_ENABLED
+	process_groups_profiling = EngineDebugger::is_profiling(SNAME("servers"));
+#endif
+	node_profiling = NodeProfiler::is_sampling_frame(p_physics ? Engine::get_singleton()->get_physics_frames() : Engine::get_singleton()->get_process_frames());
 	uint32_t from = 0;
 	uint32_t process_count = 0;
 	nodes_removed_on_group_call_lock++;
@@ -1304,7 +1570,7 @@ void SceneTree::_process(bool p_physics) {
 						if (using_threads) {
 							local_process_group_cache.push_back(process_groups[j]);
 						} else {
-							_process_group(process_groups[j], p_physics);
+							_process_group_timed(process_groups[j], p_physics);
 						}
 					}
 				}
@@ -1353,6 +1619,26 @@ void SceneTree::_process(bool p_physics) {
 		}
 	}
 
+#ifdef DEBUG_ENABLED
+	if (process_groups_profiling) {
+		_add_process_group_profile_data(group_count, p_physics);
+		process_groups_profiling = false;
+	}
+#endif
+
+	if (node_profiling) {
+		// Samples are gathered per group so threaded groups don't contend, merge them on the main thread.
+		for (uint32_t i = 0; i < group_count; i++) {
+			ProcessGroup *pg = process_groups[i];
+			NodeProfiler::add_samples(pg->node_profile_samples);
+			pg->node_profile_samples.clear();
+		}
+		if (!p_physics) {
+			NodeProfiler::frame_sampled();
+		}
+		node_profiling = false;
+	}
+
 	nodes_removed_on_group_call_lock--;
 	if (nodes_removed_on_group_call_lock == 0) {
 		nodes_removed_on_group_call.clear();
@@ -1397,17 +1683,29 @@ void SceneTree::_add_process_group(Node *p_node) {
 	process_groups_dirty = true;
 }
 
+// Branches leave the tree in reverse tree order, so their nodes are usually found
+// near the end of the (sorted) process lists. Searching from there keeps removing
+// a large branch linear instead of quadratic.
+static bool _erase_process_node(Vector<Node *> &r_nodes, Node *p_node) {
+	const int64_t pos = r_nodes.rfind(p_node);
+	if (pos < 0) {
+		return false;
+	}
+	r_nodes.remove_at(pos);
+	return true;
+}
+
 void SceneTree::_remove_node_from_process_group(Node *p_node, Node *p_owner) {
 	_THREAD_SAFE_METHOD_
 	ProcessGroup *pg = p_owner ? (ProcessGroup *)p_owner->data.process_group : &default_process_group;
 
 	if (p_node->is_processing() || p_node->is_processing_internal()) {
-		bool found = pg->nodes.erase(p_node);
+		bool found = _erase_process_node(pg->nodes, p_node);
 		ERR_FAIL_COND(!found);
 	}
 
 	if (p_node->is_physics_processing() || p_node->is_physics_processing_internal()) {
-		bool found = pg->physics_nodes.erase(p_node);
+		bool found = _erase_process_node(pg->physics_nodes, p_node);
 		ERR_FAIL_COND(!found);
 	}
 }
@@ -1642,6 +1940,327 @@ void SceneTree::queue_delete(RequiredParam<Object> rp_object) {
 	delete_queue.push_back(p_object->get_instance_id());
 }
 
+Node *SceneTree::acquire_pooled_instance(const Ref<PackedScene> &p_scene) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_COND_V(p_scene.is_null(), nullptr);
+
+	InstancePool &pool = instance_pools[p_scene->get_instance_id()];
+	Node *instance = nullptr;
+	while (!instance && !pool.idle.is_empty()) {
+		// Skip instances freed while waiting to be reused.
+		instance = ObjectDB::get_instance<Node>(pool.idle[pool.idle.size() - 1]);
+		pool.idle.resize(pool.idle.size() - 1);
+		pooled_instance_count--;
+	}
+	if (!instance) {
+		instance = p_scene->instantiate();
+		if (!instance) {
+			if (pool.scene.is_null()) {
+				instance_pools.erase(p_scene->get_instance_id());
+			}
+			ERR_FAIL_V_MSG(nullptr, vformat("Failed to instantiate scene \"%s\" for its pool.", p_scene->get_path()));
+		}
+		if (pool.scene.is_null()) {
+			pool.scene = p_scene;
+			_capture_pool_defaults(pool, instance, instance);
+		}
+		instance->data.pooled = true;
+	}
+
+	pooled_instances_in_use[instance->get_instance_id()] = p_scene->get_instance_id();
+	return instance;
+}
+
+void SceneTree::release_pooled_instance(Node *p_node) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_NULL(p_node);
+
+	HashMap<ObjectID, ObjectID>::Iterator E = pooled_instances_in_use.find(p_node->get_instance_id());
+	ERR_FAIL_COND_MSG(!E, vformat("Node \"%s\" was not acquired from an instance pool, or was already released.", p_node->get_name()));
+
+	// Like queue_free(), the node leaves the tree at the end of the frame.
+	pool_release_queue.push_back(Pair<ObjectID, ObjectID>(E->key, E->value));
+	pooled_instances_in_use.remove(E);
+}
+
+void SceneTree::clear_instance_pool(const Ref<PackedScene> &p_scene) {
+	_THREAD_SAFE_METHOD_
+
+	for (HashMap<ObjectID, InstancePool>::Iterator E = instance_pools.begin(); E;) {
+		HashMap<ObjectID, InstancePool>::Iterator N = E;
+		++N;
+		if (p_scene.is_null() || E->key == p_scene->get_instance_id()) {
+			LocalVector<ObjectID> idle = std::move(E->value.idle);
+			E->value.idle.clear();
+			pooled_instance_count -= idle.size();
+			instance_pools.remove(E);
+			for (const ObjectID &id : idle) {
+				Node *node = ObjectDB::get_instance<Node>(id);
+				if (node) {
+					memdelete(node);
+				}
+			}
+		}
+		E = N;
+	}
+}
+
+int SceneTree::get_pooled_instance_count(const Ref<PackedScene> &p_scene) const {
+	_THREAD_SAFE_METHOD_
+
+	if (p_scene.is_null()) {
+		return pooled_instance_count;
+	}
+	const InstancePool *pool = instance_pools.getptr(p_scene->get_instance_id());
+	return pool ? (int)pool->idle.size() : 0;
+}
+
+void SceneTree::_capture_pool_defaults(InstancePool &r_pool, Node *p_root, Node *p_node) {
+	r_pool.defaults.push_back(InstancePool::NodeDefaults());
+	InstancePool::NodeDefaults &defaults = r_pool.defaults[r_pool.defaults.size() - 1];
+	defaults.path = p_root->get_path_to(p_node);
+
+	List<PropertyInfo> properties;
+	p_node->get_property_list(&properties);
+	for (const PropertyInfo &E : properties) {
+		if (!(E.usage & PROPERTY_USAGE_STORAGE) || E.name == CoreStringName(script)) {
+			continue;
+		}
+
+		Variant value = p_node->get(E.name);
+		if (value.get_type() == Variant::OBJECT && value.get_validated_object()) {
+			// Nodes and resources local to scene belong to each instance, keep those.
+			Ref<Resource> res = value;
+			if (res.is_null() || res->is_local_to_scene()) {
+				continue;
+			}
+		} else if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+			value = value.duplicate(true);
+		}
+		defaults.properties.push_back(Pair<StringName, Variant>(E.name, value));
+	}
+
+	// Children last, growing the list invalidates `defaults`.
+	for (int i = 0; i < p_node->get_child_count(false); i++) {
+		_capture_pool_defaults(r_pool, p_root, p_node->get_child(i, false));
+	}
+}
+
+void SceneTree::_reset_pooled_instance(const InstancePool &p_pool, Node *p_instance) {
+	for (const InstancePool::NodeDefaults &defaults : p_pool.defaults) {
+		Node *node = p_instance->get_node_or_null(defaults.path);
+		if (!node) {
+			continue;
+		}
+
+		for (const Pair<StringName, Variant> &E : defaults.properties) {
+			if (node->get(E.first) == E.second) {
+				continue;
+			}
+			const Variant::Type type = E.second.get_type();
+			node->set(E.first, (type == Variant::ARRAY || type == Variant::DICTIONARY) ? E.second.duplicate(true) : E.second);
+		}
+
+		// Behave like a new instance when added to the tree again.
+		node->request_ready();
+	}
+}
+
+void SceneTree::_flush_pool_release_queue() {
+	_THREAD_SAFE_METHOD_
+
+	// Exiting the tree may release more instances, those wait for the next flush.
+	LocalVector<Pair<ObjectID, ObjectID>> queue = std::move(pool_release_queue);
+	pool_release_queue.clear();
+	for (const Pair<ObjectID, ObjectID> &E : queue) {
+		Node *node = ObjectDB::get_instance<Node>(E.first);
+		if (!node || node->is_queued_for_deletion()) {
+			continue;
+		}
+
+		if (node->get_parent()) {
+			node->get_parent()->remove_child(node);
+		}
+
+		InstancePool *pool = instance_pools.getptr(E.second);
+		if (!pool) {
+			memdelete(node); // The pool was cleared in the meantime.
+			continue;
+		}
+
+		_reset_pooled_instance(*pool, node);
+		pool->idle.push_back(E.first);
+		pooled_instance_count++;
+	}
+}
+
+void SceneTree::_pooled_instance_freed(Node *p_node) {
+	_THREAD_SAFE_METHOD_
+
+	// Freed with free() or queue_free() instead of being released.
+	const ObjectID id = p_node->get_instance_id();
+	if (pooled_instances_in_use.erase(id)) {
+		return;
+	}
+	for (KeyValue<ObjectID, InstancePool> &E : instance_pools) {
+		int64_t index = E.value.idle.find(id);
+		if (index >= 0) {
+			E.value.idle.remove_at_unordered(index);
+			pooled_instance_count--;
+			return;
+		}
+	}
+}
+
+void SceneTree::attach_branch(Node *p_parent, Node *p_branch, double p_frame_budget_msec) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_NULL(p_parent);
+	ERR_FAIL_NULL(p_branch);
+	ERR_FAIL_COND_MSG(p_parent->get_tree() != this, vformat("Can't attach a branch to '%s', it is not inside this SceneTree.", p_parent->get_name()));
+	ERR_FAIL_COND_MSG(p_branch->get_parent() || p_branch->is_inside_tree(), vformat("Can't attach '%s', it already has a parent.", p_branch->get_name()));
+	ERR_FAIL_COND_MSG(_is_attaching_branch(p_branch->get_instance_id()), vformat("Branch '%s' is already being attached.", p_branch->get_name()));
+	ERR_FAIL_COND(p_frame_budget_msec < 0.0);
+
+	BranchAttach attach;
+	attach.parent = p_parent->get_instance_id();
+	attach.branch = p_branch->get_instance_id();
+	attach.budget_usec = uint64_t(p_frame_budget_msec * 1000.0);
+	attach.pending.push_back({ attach.branch, attach.parent });
+	branch_attaches.push_back(attach);
+}
+
+void SceneTree::attach_scene(Node *p_parent, const String &p_path, double p_frame_budget_msec) {
+	_THREAD_SAFE_METHOD_
+	ERR_FAIL_NULL(p_parent);
+	ERR_FAIL_COND_MSG(p_parent->get_tree() != this, vformat("Can't attach a scene to '%s', it is not inside this SceneTree.", p_parent->get_name()));
+	ERR_FAIL_COND(p_frame_budget_msec < 0.0);
+
+	Error err = ResourceLoader::load_threaded_request(p_path, "PackedScene");
+	ERR_FAIL_COND_MSG(err != OK, vformat("Failed to request loading scene \"%s\" to attach it.", p_path));
+
+	BranchAttach attach;
+	attach.parent = p_parent->get_instance_id();
+	attach.scene_path = p_path;
+	attach.budget_usec = uint64_t(p_frame_budget_msec * 1000.0);
+	branch_attaches.push_back(attach);
+}
+
+int SceneTree::get_attaching_branch_count() const {
+	_THREAD_SAFE_METHOD_
+	return branch_attaches.size();
+}
+
+bool SceneTree::_is_attaching_branch(ObjectID p_branch) const {
+	for (const BranchAttach &attach : branch_attaches) {
+		if (attach.branch == p_branch) {
+			return true;
+		}
+	}
+	return false;
+}
+
+bool SceneTree::_step_branch_attach(BranchAttach &r_attach, uint64_t p_begin_usec, bool &r_worked) {
+	if (!r_attach.scene_path.is_empty()) {
+		if (ResourceLoader::load_threaded_get_status(r_attach.scene_path) == ResourceLoader::THREAD_LOAD_IN_PROGRESS) {
+			return false;
+		}
+
+		const String path = r_attach.scene_path;
+		r_attach.scene_path = String();
+		Ref<PackedScene> scene = ResourceLoader::load_threaded_get(path);
+		ERR_FAIL_COND_V_MSG(scene.is_null(), true, vformat("Failed to load scene \"%s\" to attach it.", path));
+
+		// Instantiating is not split across frames, only entering the tree is.
+		r_worked = true;
+		Node *branch = scene->instantiate();
+		ERR_FAIL_NULL_V_MSG(branch, true, vformat("Failed to instantiate scene \"%s\" to attach it.", path));
+		r_attach.branch = branch->get_instance_id();
+		r_attach.pending.push_back({ r_attach.branch, r_attach.parent });
+	}
+
+	// Nodes enter the tree in the same order add_child() would use. Each node gives up
+	// its children right before entering, so it enters alone and they follow one by one.
+	// NOTIFICATION_READY is held back until the whole branch is inside.
+	while (!r_attach.pending.is_empty() && (!r_worked || OS::get_singleton()->get_ticks_usec() - p_begin_usec < r_attach.budget_usec)) {
+		const BranchAttach::Pending next = r_attach.pending[r_attach.pending.size() - 1];
+		r_attach.pending.resize(r_attach.pending.size() - 1);
+
+		Node *node = ObjectDB::get_instance<Node>(next.node);
+		if (!node || node->data.parent) {
+			continue; // Freed or added somewhere else in the meantime.
+		}
+		Node *parent = ObjectDB::get_instance<Node>(next.parent);
+		if (!parent) {
+			memdelete(node); // Its parent was freed before it could be attached.
+			continue;
+		}
+
+		r_worked = true;
+		uint32_t first_child = r_attach.pending.size();
+		LocalVector<Node *> children;
+		node->_unlink_children(children);
+		for (uint32_t i = children.size(); i > 0; i--) {
+			r_attach.pending.push_back({ children[i - 1]->get_instance_id(), next.node });
+		}
+
+		if (next.node == r_attach.branch) {
+			parent->_validate_child_name(node);
+			parent->_add_child_nocheck(node, node->data.name, Node::INTERNAL_MODE_DISABLED, false);
+		} else {
+			parent->_relink_child(node);
+		}
+
+		if (!node->is_inside_tree()) {
+			// Its parent left the tree while entering it, the rest of this node follows it.
+			for (uint32_t i = r_attach.pending.size(); i > first_child; i--) {
+				Node *child = ObjectDB::get_instance<Node>(r_attach.pending[i - 1].node);
+				if (child && !child->data.parent) {
+					node->_relink_child(child);
+				}
+			}
+			r_attach.pending.resize(first_child);
+		}
+	}
+
+	if (!r_attach.pending.is_empty()) {
+		return false;
+	}
+
+	Node *branch = ObjectDB::get_instance<Node>(r_attach.branch);
+	if (branch && branch->is_inside_tree() && !branch->data.ready_notified && branch->data.parent->data.ready_notified) {
+		branch->_propagate_ready();
+	}
+	return true;
+}
+
+void SceneTree::_process_branch_attaches() {
+	if (branch_attaches.is_empty()) {
+		return;
+	}
+
+	// Attaches share the frame, the first one with work to do always makes progress.
+	const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+	bool worked = false;
+	LocalVector<ObjectID> attached;
+	for (List<BranchAttach>::Element *E = branch_attaches.front(); E;) {
+		List<BranchAttach>::Element *N = E->next();
+		if (_step_branch_attach(E->get(), begin_usec, worked)) {
+			if (E->get().branch.is_valid()) {
+				attached.push_back(E->get().branch);
+			}
+			branch_attaches.erase(E);
+		}
+		E = N;
+	}
+
+	for (const ObjectID &id : attached) {
+		Node *branch = ObjectDB::get_instance<Node>(id);
+		if (branch) {
+			emit_signal(SNAME("branch_attached"), branch);
+		}
+	}
+}
+
 int SceneTree::get_node_count() const {
 	return nodes_in_tree_count;
 }
@@ -1925,6 +2544,14 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("queue_delete", "obj"), &SceneTree::queue_delete);
 
+	ClassDB::bind_method(D_METHOD("acquire_pooled_instance", "scene"), &SceneTree::acquire_pooled_instance);
+	ClassDB::bind_method(D_METHOD("release_pooled_instance", "node"), &SceneTree::release_pooled_instance);
+	ClassDB::bind_method(D_METHOD("clear_instance_pool", "scene"), &SceneTree::clear_instance_pool, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count", "scene"), &SceneTree::get_pooled_instance_count, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("attach_branch", "parent", "branch", "frame_budget_msec"), &SceneTree::attach_branch, DEFVAL(1.0));
+	ClassDB::bind_method(D_METHOD("attach_scene", "parent", "path", "frame_budget_msec"), &SceneTree::attach_scene, DEFVAL(1.0));
+	ClassDB::bind_method(D_METHOD("get_attaching_branch_count"), &SceneTree::get_attaching_branch_count);
+
 	MethodInfo mi;
 	mi.name = "call_group_flags";
 	mi.arguments.push_back(PropertyInfo(Variant::INT, "flags"));
@@ -1945,6 +2572,7 @@ void SceneTree::_bind_methods() {
 
 	ClassDB::bind_method(D_METHOD("notify_group", "group", "notification"), &SceneTree::notify_group);
 	ClassDB::bind_method(D_METHOD("set_group", "group", "property", "value"), &SceneTree::set_group);
+	ClassDB::bind_method(D_METHOD("set_nodes_property", "node_ids", "property", "values"), &SceneTree::set_nodes_property);
 
 	ClassDB::bind_method(D_METHOD("get_nodes_in_group", "group"), &SceneTree::_get_nodes_in_group);
 	ClassDB::bind_method(D_METHOD("get_first_node_in_group", "group"), &SceneTree::get_first_node_in_group);
@@ -1984,6 +2612,7 @@ void SceneTree::_bind_methods() {
 	ADD_SIGNAL(MethodInfo("node_removed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, Node::get_class_static())));
 	ADD_SIGNAL(MethodInfo("node_renamed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, Node::get_class_static())));
 	ADD_SIGNAL(MethodInfo("node_configuration_warning_changed", PropertyInfo(Variant::OBJECT, "node", PROPERTY_HINT_RESOURCE_TYPE, Node::get_class_static())));
+	ADD_SIGNAL(MethodInfo("branch_attached", PropertyInfo(Variant::OBJECT, "branch", PROPERTY_HINT_RESOURCE_TYPE, Node::get_class_static())));
 
 	ADD_SIGNAL(MethodInfo("process_frame"));
 	ADD_SIGNAL(MethodInfo("physics_frame"));
@@ -1992,6 +2621,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_UNORDERED);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
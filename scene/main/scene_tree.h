@@ -36,6 +36,7 @@
 #include "core/os/thread_safe.h"
 #include "core/templates/paged_allocator.h"
 #include "core/templates/self_list.h"
+#include "scene/main/node_profiler.h"
 #include "scene/main/scene_tree_fti.h"
 
 #include <cstdlib>
@@ -106,6 +107,10 @@ private:
 		bool removed = false;
 		Node *owner = nullptr;
 		uint64_t last_pass = 0;
+#ifdef DEBUG_ENABLED
+		uint64_t profile_usec = 0; // Time spent in the last pass, only measured while profiling.
+#endif
+		LocalVector<NodeProfiler::Sample> node_profile_samples;
 	};
 
 	struct ProcessGroupSort {
@@ -122,6 +127,10 @@ private:
 	ProcessGroup default_process_group;
 
 	bool node_threading_disabled = false;
+#ifdef DEBUG_ENABLED
+	bool process_groups_profiling = false;
+#endif
+	bool node_profiling = false;
 
 #ifndef _3D_DISABLED
 	struct ClientPhysicsInterpolation {
@@ -187,6 +196,48 @@ private:
 
 	List<ObjectID> delete_queue;
 
+	// Instances of a PackedScene kept for reuse instead of being freed.
+	struct InstancePool {
+		struct NodeDefaults {
+			NodePath path;
+			LocalVector<Pair<StringName, Variant>> properties;
+		};
+
+		Ref<PackedScene> scene;
+		LocalVector<NodeDefaults> defaults; // Captured from the first instance.
+		LocalVector<ObjectID> idle;
+	};
+
+	HashMap<ObjectID, InstancePool> instance_pools; // By PackedScene.
+	HashMap<ObjectID, ObjectID> pooled_instances_in_use; // Instance to PackedScene.
+	LocalVector<Pair<ObjectID, ObjectID>> pool_release_queue;
+	int pooled_instance_count = 0;
+
+	void _capture_pool_defaults(InstancePool &r_pool, Node *p_root, Node *p_node);
+	void _reset_pooled_instance(const InstancePool &p_pool, Node *p_instance);
+	void _flush_pool_release_queue();
+	void _pooled_instance_freed(Node *p_node);
+
+	// Branches entering the tree a few nodes per frame.
+	struct BranchAttach {
+		struct Pending {
+			ObjectID node;
+			ObjectID parent;
+		};
+
+		ObjectID parent;
+		ObjectID branch;
+		String scene_path; // Set while the scene is loading.
+		uint64_t budget_usec = 0;
+		LocalVector<Pending> pending; // Stack, the next node to enter is last.
+	};
+
+	List<BranchAttach> branch_attaches;
+
+	bool _step_branch_attach(BranchAttach &r_attach, uint64_t p_begin_usec, bool &r_worked);
+	void _process_branch_attaches();
+	bool _is_attaching_branch(ObjectID p_branch) const;
+
 	uint64_t accessibility_upd_per_sec = 0;
 	bool accessibility_force_update = true;
 	HashSet<ObjectID> accessibility_change_queue;
@@ -197,6 +248,7 @@ private:
 	void _flush_ugc();
 
 	_FORCE_INLINE_ void _update_group_order(SceneTreeGroup &g);
+	int _find_group_position(const SceneTreeGroup &p_group, const Node *p_node) const;
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -239,6 +291,10 @@ private:
 
 	void _process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
+	void _process_group_timed(ProcessGroup *p_group, bool p_physics);
+#ifdef DEBUG_ENABLED
+	void _add_process_group_profile_data(uint32_t p_group_count, bool p_physics);
+#endif
 	void _process(bool p_physics);
 
 	void _remove_process_group(Node *p_node);
@@ -256,6 +312,9 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	// Bumped whenever queued transform notifications or dirty flags may have been consumed,
+	// which invalidates the subtrees Node3D remembers as already propagated.
+	uint32_t xform_change_epoch = 1;
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -298,6 +357,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_UNORDERED = 8,
 	};
 
 	RequiredResult<Window> get_root() const;
@@ -310,6 +370,7 @@ public:
 	void notify_group(const StringName &p_group, int p_notification);
 	// `set_group()` is immediate by default since Godot 4.0.
 	void set_group(const StringName &p_group, const String &p_name, const Variant &p_value);
+	int set_nodes_property(const PackedInt64Array &p_node_ids, const StringName &p_property, const Variant &p_values);
 
 	template <typename... VarArgs>
 	// `call_group()` is immediate by default since Godot 4.0.
@@ -411,6 +472,15 @@ public:
 
 	void queue_delete(RequiredParam<Object> rp_object);
 
+	Node *acquire_pooled_instance(const Ref<PackedScene> &p_scene);
+	void release_pooled_instance(Node *p_node);
+	void clear_instance_pool(const Ref<PackedScene> &p_scene);
+	int get_pooled_instance_count(const Ref<PackedScene> &p_scene) const;
+
+	void attach_branch(Node *p_parent, Node *p_branch, double p_frame_budget_msec = 1.0);
+	void attach_scene(Node *p_parent, const String &p_path, double p_frame_budget_msec = 1.0);
+	int get_attaching_branch_count() const;
+
 	Vector<Node *> get_nodes_in_group(const StringName &p_group);
 	Node *get_first_node_in_group(const StringName &p_group);
 	bool has_group(const StringName &p_identifier) const;
@@ -163,6 +163,7 @@
 #include "scene/resources/text_paragraph.h"
 #include "scene/resources/texture.h"
 #include "scene/resources/texture_rd.h"
+#include "scene/resources/texture_streamer.h"
 #include "scene/resources/theme.h"
 #include "scene/resources/video_stream.h"
 #include "scene/theme/theme_db.h"
@@ -1335,6 +1336,7 @@ void unregister_scene_types() {
 	if constexpr (GD_IS_CLASS_ENABLED(CompressedTexture2D)) {
 		ResourceLoader::remove_resource_format_loader(resource_loader_stream_texture);
 		resource_loader_stream_texture.unref();
+		TextureStreamer::clear();
 	}
 
 	ResourceSaver::remove_resource_format_saver(resource_saver_text);
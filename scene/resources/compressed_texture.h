@@ -66,10 +66,15 @@ private:
 	int w = 0;
 	int h = 0;
 	mutable Ref<BitMap> alpha_cache;
+	uint64_t streamed_size = 0; // Memory added by streaming in full detail, see TextureStreamer.
 
-	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0);
+	Error _load_data(const String &p_path, int &r_width, int &r_height, Ref<Image> &image, bool &r_request_3d, bool &r_request_normal, bool &r_request_roughness, int &mipmap_limit, int p_size_limit = 0, Size2i *r_image_size = nullptr);
 	virtual void reload_from_file() override;
 
+	friend class TextureStreamer;
+	static Ref<Image> _load_streamed_image(const String &p_path);
+	void _set_streamed_image(const Ref<Image> &p_image, uint64_t p_size);
+
 	static void _requested_3d(void *p_ud);
 	static void _requested_roughness(void *p_ud, const String &p_normal_path, RSE::TextureDetectRoughnessChannel p_roughness_channel);
 	static void _requested_normal(void *p_ud);
@@ -78,7 +83,7 @@ protected:
 	static void _bind_methods();
 
 public:
-	static Ref<Image> load_image_from_file(Ref<FileAccess> p_file, int p_size_limit);
+	static Ref<Image> load_image_from_file(Ref<FileAccess> p_file, int p_size_limit, Size2i *r_image_size = nullptr);
 
 	typedef void (*TextureFormatRequestCallback)(const Ref<CompressedTexture2D> &);
 	typedef void (*TextureFormatRoughnessRequestCallback)(const Ref<CompressedTexture2D> &, const String &p_normal_path, RSE::TextureDetectRoughnessChannel p_roughness_channel);
@@ -225,6 +225,75 @@ static Node *_find_node_by_id(Node *p_owner, Node *p_node, int32_t p_id) {
 	return nullptr;
 }
 
+struct SceneState::InstantiationPlan {
+	struct NodePlan {
+		const ClassDB::ClassInfo *class_info = nullptr; // Only for nodes created from a native class.
+		LocalVector<const ClassDB::PropertySetGet *> setters; // Matches NodeData::properties.
+	};
+
+	LocalVector<NodePlan> nodes;
+};
+
+// The built-in setter path of Object::set(), with the setter already looked up.
+static void _call_property_setter(Object *p_object, const ClassDB::PropertySetGet *p_setter, const Variant &p_value, bool &r_valid) {
+	Callable::CallError ce;
+	if (p_setter->index >= 0) {
+		Variant index = p_setter->index;
+		const Variant *args[2] = { &index, &p_value };
+		p_setter->_setptr->call(p_object, args, 2, ce);
+	} else {
+		const Variant *args[1] = { &p_value };
+		p_setter->_setptr->call(p_object, args, 1, ce);
+	}
+	r_valid = ce.error == Callable::CallError::CALL_OK;
+}
+
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan) {
+		return instantiation_plan;
+	}
+
+	InstantiationPlan *plan = memnew(InstantiationPlan);
+	plan->nodes.resize(nodes.size());
+	for (int i = 0; i < nodes.size(); i++) {
+		const NodeData &n = nodes[i];
+		if ((i == 0 && base_scene_idx >= 0) || n.instance >= 0 || n.type < 0 || n.type >= names.size()) {
+			continue; // Instanced, inherited or invalid, these go through the regular path.
+		}
+
+		InstantiationPlan::NodePlan &node_plan = plan->nodes[i];
+		node_plan.class_info = ClassDB::get_native_class_for_instantiation(names[n.type]);
+		if (!node_plan.class_info) {
+			continue;
+		}
+
+		node_plan.setters.resize(n.properties.size());
+		for (int j = 0; j < n.properties.size(); j++) {
+			const int name = n.properties[j].name;
+			const ClassDB::PropertySetGet *setter = nullptr;
+			if (!(name & FLAG_PATH_PROPERTY_IS_NODE) && name >= 0 && name < names.size()) {
+				setter = ClassDB::get_property_setget(node_plan.class_info, names[name]);
+				if (setter && !setter->_setptr) {
+					setter = nullptr;
+				}
+			}
+			node_plan.setters[j] = setter;
+		}
+	}
+
+	instantiation_plan = plan;
+	return plan;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	if (instantiation_plan) {
+		memdelete(instantiation_plan);
+		instantiation_plan = nullptr;
+	}
+}
+
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
@@ -272,8 +341,18 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 
 	bool deep_search_warned = false;
 
+	// The editor may reload classes and needs the placeholders ClassDB creates, so it keeps using lookups.
+	const InstantiationPlan *plan = nullptr;
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		plan = _get_instantiation_plan();
+		if (plan->nodes.size() != (uint32_t)nc) {
+			plan = nullptr;
+		}
+	}
+
 	for (int i = 0; i < nc; i++) {
 		const NodeData &n = nd[i];
+		const ClassDB::PropertySetGet *const *node_setters = nullptr;
 
 		Node *parent = nullptr;
 		String old_parent_path;
@@ -388,9 +467,13 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 			}
 		} else {
 			// Node belongs to this scene and must be created.
-			Object *obj = ClassDB::instantiate(snames[n.type]);
+			const ClassDB::ClassInfo *class_info = plan ? plan->nodes[i].class_info : nullptr;
+			Object *obj = class_info ? class_info->creation_func(true) : ClassDB::instantiate(snames[n.type]);
 
 			node = Object::cast_to<Node>(obj);
+			if (node && class_info && !plan->nodes[i].setters.is_empty()) {
+				node_setters = plan->nodes[i].setters.ptr();
+			}
 
 			if (!node) {
 				if (obj) {
@@ -564,7 +647,12 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 						}
 
 						if (set_valid) {
-							node->set(snames[nprops[j].name], value, &valid);
+							// A script may handle the property itself, so only skip the lookup without one.
+							if (node_setters && node_setters[j] && !node->get_script_instance()) {
+								_call_property_setter(node, node_setters[j], value, valid);
+							} else {
+								node->set(snames[nprops[j].name], value, &valid);
+							}
 						}
 						if (p_edit_state == GEN_EDIT_STATE_INSTANCE && value.get_type() != Variant::OBJECT) {
 							value = value.duplicate(true); // Duplicate arrays and dictionaries for the editor.
@@ -1508,6 +1596,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1742,6 +1831,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 
 	ERR_FAIL_COND_MSG(version > PACKED_SCENE_VERSION, "Save format version too new.");
 
+	_clear_instantiation_plan();
+
 	const int node_count = p_dictionary["node_count"];
 	const Vector<int> snodes = p_dictionary["nodes"];
 	ERR_FAIL_COND(snodes.size() < node_count);
@@ -2394,6 +2485,7 @@ int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int
 	nd.instance = p_instance;
 	nd.index = p_index;
 
+	_clear_instantiation_plan();
 	nodes.push_back(nd);
 
 	ids.push_back(p_unique_id);
@@ -2412,6 +2504,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 		prop.name |= FLAG_PATH_PROPERTY_IS_NODE;
 	}
 	prop.value = p_value;
+	_clear_instantiation_plan();
 	nodes.write[p_node].properties.push_back(prop);
 }
 
@@ -2533,6 +2626,10 @@ void SceneState::_bind_methods() {
 SceneState::SceneState() {
 }
 
+SceneState::~SceneState() {
+	_clear_instantiation_plan();
+}
+
 ////////////////
 
 void PackedScene::_set_bundled_scene(const Dictionary &p_scene) {
@@ -92,6 +92,15 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Class and property setter lookups, resolved on the first runtime instantiation and
+	// replayed by the later ones. Cleared whenever the nodes or their properties change.
+	struct InstantiationPlan;
+	mutable InstantiationPlan *instantiation_plan = nullptr;
+	mutable BinaryMutex instantiation_plan_mutex;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _clear_instantiation_plan();
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map, HashSet<int32_t> &ids_saved);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -241,6 +250,7 @@ public:
 #endif
 
 	SceneState();
+	~SceneState();
 };
 
 VARIANT_ENUM_CAST(SceneState::GenEditState)
@@ -0,0 +1,190 @@
+/**************************************************************************/
+/*  texture_streamer.cpp                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "texture_streamer.h"
+
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "scene/resources/compressed_texture.h"
+
+bool TextureStreamer::is_enabled() {
+	return GLOBAL_GET_CACHED(bool, "rendering/textures/streaming/enabled") && !Engine::get_singleton()->is_editor_hint();
+}
+
+int TextureStreamer::get_initial_size() {
+	return GLOBAL_GET_CACHED(int, "rendering/textures/streaming/initial_size");
+}
+
+void TextureStreamer::queue(const CompressedTexture2D *p_texture, const String &p_path, uint64_t p_size) {
+	Request *request = memnew(Request);
+	request->texture = p_texture->get_instance_id();
+	request->path = p_path;
+	request->size = p_size;
+
+	MutexLock lock(mutex);
+	pending.push_back(request);
+}
+
+void TextureStreamer::cancel(const CompressedTexture2D *p_texture, uint64_t p_streamed_size) {
+	const ObjectID id = p_texture->get_instance_id();
+
+	MutexLock lock(mutex);
+	resident_size -= MIN(resident_size, p_streamed_size);
+
+	List<Request *>::Element *E = pending.front();
+	while (E) {
+		List<Request *>::Element *N = E->next();
+		if (E->get()->texture == id) {
+			memdelete(E->get());
+			pending.erase(E);
+		}
+		E = N;
+	}
+
+	// Requests already loading release their reservation now, and are dropped once done.
+	for (Request *request : loading) {
+		if (request->texture == id && !request->cancelled) {
+			resident_size -= MIN(resident_size, request->size);
+			request->size = 0;
+			request->cancelled = true;
+		}
+	}
+}
+
+void TextureStreamer::_load_task(void *p_userdata) {
+	Request *request = (Request *)p_userdata;
+	request->image = CompressedTexture2D::_load_streamed_image(request->path);
+}
+
+void TextureStreamer::_finish_request(Request *p_request) {
+	WorkerThreadPool::get_singleton()->wait_for_task_completion(p_request->task);
+
+	CompressedTexture2D *texture = ObjectDB::get_instance<CompressedTexture2D>(p_request->texture);
+	if (!p_request->cancelled && texture && p_request->image.is_valid() && texture->get_load_path() == p_request->path) {
+		texture->_set_streamed_image(p_request->image, p_request->size);
+	} else {
+		MutexLock lock(mutex);
+		resident_size -= MIN(resident_size, p_request->size);
+	}
+	memdelete(p_request);
+}
+
+void TextureStreamer::_start_loads() {
+	const uint32_t max_loads = MAX(1, GLOBAL_GET_CACHED(int, "rendering/textures/streaming/max_loads_per_frame"));
+	const uint64_t budget = uint64_t(MAX(0, GLOBAL_GET_CACHED(int, "rendering/textures/streaming/memory_budget_mb"))) * 1024 * 1024;
+
+	MutexLock lock(mutex);
+	while (!pending.is_empty() && loading.size() < max_loads) {
+		Request *request = pending.front()->get();
+		if (budget > 0 && resident_size + request->size > budget) {
+			break; // Stays at reduced detail until memory is released.
+		}
+		pending.pop_front();
+
+		// Reserved while loading, owned by the texture once it's swapped in.
+		resident_size += request->size;
+		request->task = WorkerThreadPool::get_singleton()->add_native_task(&TextureStreamer::_load_task, request, false, "Stream texture");
+		loading.push_back(request);
+	}
+}
+
+void TextureStreamer::process() {
+	// `loading` is only changed on the main thread, but cancel() reads it from any thread.
+	LocalVector<Request *> finished;
+	{
+		MutexLock lock(mutex);
+		for (uint32_t i = 0; i < loading.size();) {
+			if (WorkerThreadPool::get_singleton()->is_task_completed(loading[i]->task)) {
+				finished.push_back(loading[i]);
+				loading.remove_at_unordered(i);
+			} else {
+				i++;
+			}
+		}
+	}
+
+	for (Request *request : finished) {
+		_finish_request(request);
+	}
+
+	_start_loads();
+}
+
+void TextureStreamer::flush() {
+	while (true) {
+		_start_loads();
+
+		LocalVector<Request *> finished;
+		{
+			MutexLock lock(mutex);
+			finished = std::move(loading);
+			loading.clear();
+		}
+		if (finished.is_empty()) {
+			break;
+		}
+		for (Request *request : finished) {
+			_finish_request(request);
+		}
+	}
+}
+
+void TextureStreamer::clear() {
+	LocalVector<Request *> finished;
+	{
+		MutexLock lock(mutex);
+		finished = std::move(loading);
+		loading.clear();
+	}
+
+	uint64_t reserved_size = 0;
+	for (Request *request : finished) {
+		WorkerThreadPool::get_singleton()->wait_for_task_completion(request->task);
+		reserved_size += request->size;
+		memdelete(request);
+	}
+
+	MutexLock lock(mutex);
+	resident_size -= MIN(resident_size, reserved_size);
+	for (Request *request : pending) {
+		memdelete(request);
+	}
+	pending.clear();
+}
+
+uint64_t TextureStreamer::get_resident_size() {
+	MutexLock lock(mutex);
+	return resident_size;
+}
+
+uint32_t TextureStreamer::get_pending_count() {
+	MutexLock lock(mutex);
+	return pending.size() + loading.size();
+}
@@ -0,0 +1,82 @@
+/**************************************************************************/
+/*  texture_streamer.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/io/image.h"
+#include "core/object/object_id.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/mutex.h"
+#include "core/templates/list.h"
+#include "core/templates/local_vector.h"
+
+class CompressedTexture2D;
+
+// Streams in the full detail of textures that were first loaded at a reduced size.
+// With `rendering/textures/streaming/enabled`, CompressedTexture2D only loads its
+// smallest mipmaps and queues the rest here. Full detail is decoded on worker
+// threads and swapped in on the main thread, a few textures per frame, while the
+// memory used by streamed textures stays within the configured budget.
+class TextureStreamer {
+	struct Request {
+		ObjectID texture;
+		String path;
+		uint64_t size = 0; // Estimated memory at full detail.
+		Ref<Image> image; // Set by the loading task.
+		WorkerThreadPool::TaskID task = WorkerThreadPool::INVALID_TASK_ID;
+		bool cancelled = false; // The texture was reloaded or freed while loading.
+	};
+
+	static inline BinaryMutex mutex;
+	static inline List<Request *> pending;
+	static inline LocalVector<Request *> loading;
+	static inline uint64_t resident_size = 0;
+
+	static void _load_task(void *p_userdata);
+	static void _finish_request(Request *p_request);
+	static void _start_loads();
+
+public:
+	static bool is_enabled();
+	static int get_initial_size();
+
+	static void queue(const CompressedTexture2D *p_texture, const String &p_path, uint64_t p_size);
+	// Drops pending requests of a texture and releases the memory it streamed in.
+	static void cancel(const CompressedTexture2D *p_texture, uint64_t p_streamed_size);
+
+	// Called once per frame by the SceneTree.
+	static void process();
+	// Loads everything that fits in the budget right away.
+	static void flush();
+	static void clear();
+
+	static uint64_t get_resident_size();
+	static uint32_t get_pending_count();
+};
@@ -116,7 +116,14 @@ public:
 	virtual void texture_drawable_generate_mipmaps(RID p_texture) override {}
 	virtual RID texture_drawable_get_default_material() const override { return RID(); }
 
-	virtual void texture_replace(RID p_texture, RID p_by_texture) override { texture_free(p_by_texture); }
+	virtual void texture_replace(RID p_texture, RID p_by_texture) override {
+		DummyTexture *t = texture_owner.get_or_null(p_texture);
+		DummyTexture *by = texture_owner.get_or_null(p_by_texture);
+		if (t && by) {
+			t->image = by->image;
+		}
+		texture_free(p_by_texture);
+	}
 	virtual void texture_set_size_override(RID p_texture, int p_width, int p_height) override {}
 
 	virtual void texture_set_path(RID p_texture, const String &p_path) override {}
@@ -185,10 +185,62 @@ int RendererCanvasCull::_count_ysort_children(RendererCanvasCull::Item *p_canvas
 void RendererCanvasCull::_mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner) {
 	do {
 		ysort_owner->ysort_children_count = -1;
+		ysort_owner->ysort_order_dirty = true;
 		ysort_owner = canvas_item_owner.owns(ysort_owner->parent) ? canvas_item_owner.get_or_null(ysort_owner->parent) : nullptr;
 	} while (ysort_owner && ysort_owner->sort_y);
 }
 
+void RendererCanvasCull::_sort_ysort_items(RendererCanvasCull::Item *p_ysort_root, RendererCanvasCull::Item **r_items, int p_item_count) {
+	const uint64_t pass = ++ysort_pass_count;
+	for (int i = 0; i < p_item_count; i++) {
+		r_items[i]->ysort_pass = pass;
+	}
+
+	// Items usually move little between frames, so the order from the previous pass is nearly sorted already.
+	// It can only be reused if the subtree didn't change and exactly the same items were collected this time
+	// (the cull mask can differ between viewports drawing the same canvas).
+	LocalVector<Item *> &order = p_ysort_root->ysort_order;
+	bool reuse_order = !p_ysort_root->ysort_order_dirty && order.size() == uint32_t(p_item_count);
+	for (uint32_t i = 0; reuse_order && i < order.size(); i++) {
+		reuse_order = order[i]->ysort_pass == pass;
+	}
+
+	ItemYSort compare;
+	bool sorted = false;
+	if (reuse_order) {
+		memcpy(r_items, order.ptr(), p_item_count * sizeof(Item *));
+
+		// Insertion sort is linear on nearly sorted input. Give up if items moved too much, as it is quadratic otherwise.
+		const int64_t max_shifts = int64_t(p_item_count) * YSORT_MAX_SHIFTS_PER_ITEM;
+		int64_t shifts = 0;
+		sorted = true;
+		for (int i = 1; i < p_item_count; i++) {
+			Item *item = r_items[i];
+			int j = i;
+			while (j > 0 && compare(item, r_items[j - 1])) {
+				r_items[j] = r_items[j - 1];
+				j--;
+			}
+			r_items[j] = item;
+
+			shifts += i - j;
+			if (shifts > max_shifts) {
+				sorted = false;
+				break;
+			}
+		}
+	}
+
+	if (!sorted) {
+		SortArray<Item *, ItemYSort> sorter;
+		sorter.sort(r_items, p_item_count);
+	}
+
+	order.resize(p_item_count);
+	memcpy(order.ptr(), r_items, p_item_count * sizeof(Item *));
+	p_ysort_root->ysort_order_dirty = false;
+}
+
 void RendererCanvasCull::_attach_canvas_item_for_draw(RendererCanvasCull::Item *ci, RendererCanvasCull::Item *p_canvas_clip, RendererCanvasRender::Item **r_z_list, RendererCanvasRender::Item **r_z_last_list, const Transform2D &p_transform, const Rect2 &p_clip_rect, Rect2 p_global_rect, const Color &p_modulate, int p_z, RendererCanvasCull::Item *p_material_owner, bool p_use_canvas_group, RendererCanvasRender::Item *r_canvas_group_from) {
 	if (ci->copy_back_buffer) {
 		ci->copy_back_buffer->screen_rect = p_transform.xform(ci->copy_back_buffer->rect).intersection(p_clip_rect);
@@ -452,8 +504,7 @@ void RendererCanvasCull::_cull_canvas_item(Item *p_canvas_item, const Transform2
 			int i = 1;
 			_collect_ysort_children(ci, p_material_owner, Color(1, 1, 1, 1), child_items, i, child_item_count, p_z, p_canvas_cull_mask);
 
-			SortArray<Item *, ItemYSort> sorter;
-			sorter.sort(child_items, child_item_count);
+			_sort_ysort_items(ci, child_items, child_item_count);
 
 			for (i = 0; i < child_item_count; i++) {
 				_cull_canvas_item(child_items[i], final_xform * child_items[i]->ysort_xform, p_clip_rect, modulate * child_items[i]->ysort_modulate, child_items[i]->ysort_parent_abs_z_index, r_z_list, r_z_last_list, (Item *)ci->final_clip_owner, (Item *)child_items[i]->material_owner, true, p_canvas_cull_mask, child_items[i]->repeat_size, child_items[i]->repeat_times, child_items[i]->repeat_source_item);
@@ -1876,6 +1927,9 @@ void RendererCanvasCull::canvas_item_set_sort_children_by_y(RID p_item, bool p_e
 	ERR_FAIL_NULL(canvas_item);
 
 	canvas_item->sort_y = p_enable;
+	if (!p_enable) {
+		canvas_item->ysort_order.reset();
+	}
 
 	_mark_ysort_dirty(canvas_item);
 }
@@ -59,6 +59,9 @@ public:
 		Transform2D ysort_xform; // Relative to y-sorted subtree's root item (identity for such root). Its `origin.y` is used for sorting.
 		int ysort_index;
 		int ysort_parent_abs_z_index; // Absolute Z index of parent. Only populated and used when y-sorting.
+		uint64_t ysort_pass; // Last y-sort pass this item was collected in.
+		bool ysort_order_dirty;
+		LocalVector<Item *> ysort_order; // Sorted items from the last y-sort pass rooted at this item, used as a starting point for the next one.
 		uint32_t visibility_layer = 0xffffffff;
 
 		Vector<Item *> child_items;
@@ -98,6 +101,8 @@ public:
 			ysort_xform = Transform2D();
 			ysort_index = 0;
 			ysort_parent_abs_z_index = 0;
+			ysort_pass = 0;
+			ysort_order_dirty = true;
 
 			dependency_tracker.userdata = this;
 			dependency_tracker.changed_callback = &RendererCanvasCull::_dependency_changed;
@@ -212,6 +217,11 @@ private:
 	void _collect_ysort_children(RendererCanvasCull::Item *p_canvas_item, RendererCanvasCull::Item *p_material_owner, const Color &p_modulate, RendererCanvasCull::Item **r_items, int &r_index, int &r_ysort_children_count, int p_z, uint32_t p_canvas_cull_mask);
 	int _count_ysort_children(RendererCanvasCull::Item *p_canvas_item);
 	void _mark_ysort_dirty(RendererCanvasCull::Item *ysort_owner);
+	void _sort_ysort_items(RendererCanvasCull::Item *p_ysort_root, RendererCanvasCull::Item **r_items, int p_item_count);
+
+	// Y-sort passes fall back to a full sort when the previous order needs more than this many shifts per item to be fixed.
+	static constexpr int YSORT_MAX_SHIFTS_PER_ITEM = 8;
+	uint64_t ysort_pass_count = 0;
 
 	static constexpr int z_range = RSE::CANVAS_ITEM_Z_MAX - RSE::CANVAS_ITEM_Z_MIN + 1;
 
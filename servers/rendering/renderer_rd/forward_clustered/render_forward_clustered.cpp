@@ -824,8 +824,6 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 		p_render_info[RSE::VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME] += element_total;
 	}
 
-	uint32_t repeats = 0;
-	GeometryInstanceSurfaceDataCache *prev_surface = nullptr;
 	for (uint32_t i = 0; i < element_total; i++) {
 		GeometryInstanceSurfaceDataCache *surface = rl->elements[i + p_offset];
 		GeometryInstanceForwardClustered *inst = surface->owner;
@@ -875,27 +873,43 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 
 		scene_state.curr_gpu_ptr[p_render_list][i + p_offset] = instance_data;
 
-		const bool cant_repeat = instance_data.flags & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
+		RenderElementInfo &element_info = rl->element_info[p_offset + i];
+
+		element_info.value = uint32_t(surface->sort.sort_key1 & 0xFFF);
+	}
+
+	const uint32_t draw_calls = _fill_element_repeats(rl->elements.ptr() + p_offset, rl->element_info.ptr() + p_offset, element_total);
+	if (p_render_info) {
+		p_render_info[RSE::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME] += draw_calls;
+		p_render_info[RSE::VIEWPORT_RENDER_INFO_INSTANCED_OBJECTS_IN_FRAME] += element_total - draw_calls;
+	}
+
+	if (p_update_buffer && element_total > 0u) {
+		RenderingDevice::get_singleton()->buffer_flush(scene_state.instance_buffer[p_render_list]._get(0u));
+	}
+}
+
+uint32_t RenderForwardClustered::_fill_element_repeats(GeometryInstanceSurfaceDataCache *const *p_elements, RenderElementInfo *p_element_info, uint32_t p_element_count) {
+	uint32_t draw_calls = 0;
+	uint32_t repeats = 0;
+	const GeometryInstanceSurfaceDataCache *prev_surface = nullptr;
+	for (uint32_t i = 0; i < p_element_count; i++) {
+		const GeometryInstanceSurfaceDataCache *surface = p_elements[i];
+		const GeometryInstanceForwardClustered *inst = surface->owner;
+
+		const bool cant_repeat = inst->flags_cache & INSTANCE_DATA_FLAG_MULTIMESH || inst->mesh_instance.is_valid();
 
 		if (prev_surface != nullptr && !cant_repeat && prev_surface->sort.sort_key1 == surface->sort.sort_key1 && prev_surface->sort.sort_key2 == surface->sort.sort_key2 && inst->mirror == prev_surface->owner->mirror && repeats < RenderElementInfo::MAX_REPEATS) {
 			//this element is the same as the previous one, count repeats to draw it using instancing
 			repeats++;
 		} else {
-			if (repeats > 0) {
-				for (uint32_t j = 1; j <= repeats; j++) {
-					rl->element_info[p_offset + i - j].repeat = j;
-				}
+			for (uint32_t j = 1; j <= repeats; j++) {
+				p_element_info[i - j].repeat = j;
 			}
 			repeats = 1;
-			if (p_render_info) {
-				p_render_info[RSE::VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME]++;
-			}
+			draw_calls++;
 		}
 
-		RenderElementInfo &element_info = rl->element_info[p_offset + i];
-
-		element_info.value = uint32_t(surface->sort.sort_key1 & 0xFFF);
-
 		if (cant_repeat) {
 			prev_surface = nullptr;
 		} else {
@@ -903,15 +917,11 @@ void RenderForwardClustered::_fill_instance_data(RenderListType p_render_list, i
 		}
 	}
 
-	if (repeats > 0) {
-		for (uint32_t j = 1; j <= repeats; j++) {
-			rl->element_info[p_offset + element_total - j].repeat = j;
-		}
+	for (uint32_t j = 1; j <= repeats; j++) {
+		p_element_info[p_element_count - j].repeat = j;
 	}
 
-	if (p_update_buffer && element_total > 0u) {
-		RenderingDevice::get_singleton()->buffer_flush(scene_state.instance_buffer[p_render_list]._get(0u));
-	}
+	return draw_calls;
 }
 
 _FORCE_INLINE_ static uint32_t _indices_to_primitives(RSE::PrimitiveType p_primitive, uint32_t p_indices) {
@@ -59,6 +59,7 @@ namespace RendererSceneRenderImplementation {
 
 class RenderForwardClustered : public RendererSceneRenderRD {
 	friend SceneShaderForwardClustered;
+	friend class TestRenderForwardClusteredAccessor;
 
 	enum {
 		SCENE_UNIFORM_SET = 0,
@@ -475,6 +476,10 @@ private:
 	void _render_list_with_draw_list(RenderListParameters *p_params, RID p_framebuffer, BitField<RD::DrawFlags> p_draw_flags = RD::DRAW_DEFAULT_ALL, const Vector<Color> &p_clear_color_values = Vector<Color>(), float p_clear_depth_value = 0.0, uint32_t p_clear_stencil_value = 0, const Rect2 &p_region = Rect2());
 
 	void _fill_instance_data(RenderListType p_render_list, int *p_render_info = nullptr, uint32_t p_offset = 0, int32_t p_max_elements = -1, bool p_update_buffer = true);
+	// Consecutive elements of a sorted render list that share surface, material, shader, LOD and mirroring
+	// are drawn with a single instanced draw call. Stores the instances left in its run in each element's
+	// `repeat`, and returns the number of draw calls.
+	static uint32_t _fill_element_repeats(GeometryInstanceSurfaceDataCache *const *p_elements, RenderElementInfo *p_element_info, uint32_t p_element_count);
 	void _fill_render_list(RenderListType p_render_list, const RenderDataRD *p_render_data, PassMode p_pass_mode, bool p_using_sdfgi = false, bool p_using_opaque_gi = false, bool p_using_motion_pass = false, bool p_append = false);
 
 	HashMap<Size2i, RID> sdfgi_framebuffer_size_cache;
@@ -32,17 +32,26 @@
 
 #include "core/object/worker_thread_pool.h"
 #include "core/os/mutex.h"
+#include "core/os/os.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/rb_set.h"
 #include "core/templates/rid.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/vector.h"
 #include "servers/rendering/rendering_device.h"
 #include "servers/rendering/rendering_server_enums.h"
 
 #define PRINT_PIPELINE_COMPILATION_KEYS 0
 
+// Shared by all pipeline hash maps, regardless of the key type.
+struct PipelineCompilationStatistics {
+	static inline SafeNumeric<uint32_t> in_progress{ 0 };
+	static inline SafeNumeric<uint64_t> stalls{ 0 };
+	static inline SafeNumeric<uint64_t> time_usec{ 0 };
+};
+
 template <typename Key, typename CreationClass, typename CreationFunction>
 class PipelineHashMapRD {
 private:
@@ -84,6 +93,13 @@ private:
 		return !hashes_added.is_empty();
 	}
 
+	void _compile_pipeline_task(Key p_key) {
+		const uint64_t begin_usec = OS::get_singleton()->get_ticks_usec();
+		(creation_object->*creation_function)(p_key);
+		PipelineCompilationStatistics::time_usec.add(OS::get_singleton()->get_ticks_usec() - begin_usec);
+		PipelineCompilationStatistics::in_progress.decrement();
+	}
+
 	void _wait_for_all_pipelines() {
 		thread_local LocalVector<WorkerThreadPool::TaskID> tasks_to_wait;
 		tasks_to_wait.clear();
@@ -148,7 +164,8 @@ public:
 #endif
 
 		// Queue a background compilation task.
-		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_template_task(creation_object, creation_function, p_key, p_high_priority, "PipelineCompilation");
+		PipelineCompilationStatistics::in_progress.increment();
+		WorkerThreadPool::TaskID task_id = WorkerThreadPool::get_singleton()->add_template_task(this, &PipelineHashMapRD::_compile_pipeline_task, p_key, p_high_priority, "PipelineCompilation");
 		compilation_tasks.insert(p_key_hash, task_id);
 	}
 
@@ -191,6 +208,7 @@ public:
 			compile_pipeline(p_key, p_key_hash, p_source, p_wait_for_compilation);
 
 			if (p_wait_for_compilation) {
+				PipelineCompilationStatistics::stalls.increment();
 				wait_for_pipeline(p_key_hash);
 				_add_new_pipelines_to_map();
 
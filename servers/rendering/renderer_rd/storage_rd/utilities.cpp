@@ -32,6 +32,7 @@
 
 #include "servers/rendering/renderer_rd/environment/fog.h"
 #include "servers/rendering/renderer_rd/environment/gi.h"
+#include "servers/rendering/renderer_rd/pipeline_hash_map_rd.h"
 #include "servers/rendering/renderer_rd/storage_rd/light_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/mesh_storage.h"
 #include "servers/rendering/renderer_rd/storage_rd/particles_storage.h"
@@ -308,6 +309,12 @@ uint64_t Utilities::get_rendering_info(RSE::RenderingInfo p_info) {
 		return buffer_mem_cache;
 	} else if (p_info == RSE::RENDERING_INFO_VIDEO_MEM_USED) {
 		return total_mem_cache;
+	} else if (p_info == RSE::RENDERING_INFO_PIPELINE_COMPILATIONS_IN_PROGRESS) {
+		return PipelineCompilationStatistics::in_progress.get();
+	} else if (p_info == RSE::RENDERING_INFO_PIPELINE_COMPILATION_STALLS) {
+		return PipelineCompilationStatistics::stalls.get();
+	} else if (p_info == RSE::RENDERING_INFO_PIPELINE_COMPILATION_TIME_USEC) {
+		return PipelineCompilationStatistics::time_usec.get();
 	}
 	return 0;
 }
@@ -1236,6 +1236,15 @@ String RenderingDevice::get_perf_report() const {
 	perf_report_text += " bytes:" + String::num_int64(copy_bytes_count);
 
 	perf_report_text += " lazily alloc:" + String::num_int64(driver->get_lazily_memory_used());
+
+	const RDG::Statistics &graph_statistics = draw_graph.get_statistics();
+	perf_report_text += " graph commands:" + String::num_int64(graph_statistics.command_count);
+	perf_report_text += " levels:" + String::num_int64(graph_statistics.level_count);
+	perf_report_text += " barriers:" + String::num_int64(graph_statistics.barrier_count);
+	perf_report_text += " texture barriers:" + String::num_int64(graph_statistics.texture_barrier_count);
+	perf_report_text += " buffer barriers:" + String::num_int64(graph_statistics.buffer_barrier_count);
+	perf_report_text += " reorder usec:" + String::num_int64(graph_statistics.reorder_usec);
+	perf_report_text += " end usec:" + String::num_int64(graph_statistics.end_usec);
 	return perf_report_text;
 }
 
@@ -30,6 +30,8 @@
 
 #include "rendering_device_graph.h"
 
+#include "core/os/os.h"
+
 #define PRINT_RENDER_GRAPH 0
 #define FORCE_FULL_ACCESS_BITS 0
 #define PRINT_RESOURCE_TRACKER_TOTAL 0
@@ -1456,9 +1458,14 @@ void RenderingDeviceGraph::_group_barriers_for_render_commands(RDD::CommandBuffe
 	const VectorView<RDD::AccelerationStructureBarrier> acceleration_structure_barriers = !are_acceleration_structure_barriers_empty ? barrier_group.acceleration_structure_barriers : VectorView<RDD::AccelerationStructureBarrier>();
 
 	driver->command_pipeline_barrier(p_command_buffer, barrier_group.src_stages, barrier_group.dst_stages, memory_barriers, buffer_barriers, texture_barriers, acceleration_structure_barriers);
+	statistics.barrier_count++;
+	statistics.texture_barrier_count += texture_barriers.size();
+	statistics.buffer_barrier_count += buffer_barriers.size();
 
 	bool separate_texture_barriers = !barrier_group.normalization_barriers.is_empty() && !barrier_group.transition_barriers.is_empty();
 	if (separate_texture_barriers) {
+		statistics.barrier_count++;
+		statistics.texture_barrier_count += barrier_group.transition_barriers.size();
 		driver->command_pipeline_barrier(p_command_buffer, barrier_group.src_stages, barrier_group.dst_stages, VectorView<RDD::MemoryAccessBarrier>(), VectorView<RDD::BufferBarrier>(), barrier_group.transition_barriers, VectorView<RDD::AccelerationStructureBarrier>());
 	}
 }
@@ -2597,11 +2604,15 @@ void RenderingDeviceGraph::end_label() {
 }
 
 void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RDD::CommandBufferID &r_command_buffer, CommandBufferPool &r_command_buffer_pool) {
+	statistics = Statistics();
 	if (command_count == 0) {
 		// No commands have been logged, do nothing.
 		return;
 	}
 
+	const uint64_t end_begin_usec = OS::get_singleton()->get_ticks_usec();
+	statistics.command_count = command_count;
+
 	thread_local LocalVector<RecordedCommandSort> commands_sorted;
 	if (p_reorder_commands) {
 		thread_local LocalVector<int64_t> command_stack;
@@ -2734,7 +2745,9 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 			_print_render_commands(commands_sorted.ptr(), command_count);
 #endif
 
+			const uint64_t sort_begin_usec = OS::get_singleton()->get_ticks_usec();
 			commands_sorted.sort();
+			statistics.reorder_usec = OS::get_singleton()->get_ticks_usec() - sort_begin_usec;
 
 #if PRINT_RENDER_GRAPH
 			print_line("AFTER SORT");
@@ -2765,11 +2778,13 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 			_boost_priority_for_render_commands(level_command_ptr, level_command_count, boosted_priority);
 			_group_barriers_for_render_commands(r_command_buffer, level_command_ptr, level_command_count, p_full_barriers);
 			_run_render_commands(current_level, level_command_ptr, level_command_count, r_command_buffer, r_command_buffer_pool, current_label_index, current_label_level);
+			statistics.level_count = current_level + 1;
 
 #if PRINT_RENDER_GRAPH
 			print_line("COMMANDS", command_count, "LEVELS", current_level + 1);
 #endif
 		} else {
+			statistics.level_count = command_count;
 			for (uint32_t i = 0; i < command_count; i++) {
 				_group_barriers_for_render_commands(r_command_buffer, &commands_sorted[i], 1, p_full_barriers);
 				_run_render_commands(i, &commands_sorted[i], 1, r_command_buffer, r_command_buffer_pool, current_label_index, current_label_level);
@@ -2786,6 +2801,8 @@ void RenderingDeviceGraph::end(bool p_reorder_commands, bool p_full_barriers, RD
 #endif
 	}
 
+	statistics.end_usec = OS::get_singleton()->get_ticks_usec() - end_begin_usec;
+
 	// Advance the frame counter. It's not necessary to do this if no commands are recorded because that means no secondary command buffers were used.
 	frame = (frame + 1) % frames.size();
 }
@@ -270,6 +270,17 @@ public:
 		ATTACHMENT_OPERATION_IGNORE,
 	};
 
+	// Describes how the commands recorded during the last call to end() were reordered and synchronized.
+	struct Statistics {
+		uint32_t command_count = 0;
+		uint32_t level_count = 0;
+		uint32_t barrier_count = 0; // Pipeline barriers issued to the driver.
+		uint32_t texture_barrier_count = 0; // Layout transitions and other texture barriers.
+		uint32_t buffer_barrier_count = 0;
+		uint64_t reorder_usec = 0; // CPU time spent sorting commands into levels.
+		uint64_t end_usec = 0; // CPU time spent in end(), including reordering and recording into command buffers.
+	};
+
 private:
 	struct InstructionList {
 		LocalVector<uint8_t> data;
@@ -846,6 +857,7 @@ private:
 	WorkaroundsState workarounds_state;
 	TightLocalVector<Frame> frames;
 	uint32_t frame = 0;
+	Statistics statistics;
 
 #ifdef DEV_ENABLED
 	RBMap<ResourceTracker *, uint32_t> write_dependency_counters;
@@ -955,6 +967,7 @@ public:
 	void begin_label(const Span<char> &p_label_name, const Color &p_color);
 	void end_label();
 	void end(bool p_reorder_commands, bool p_full_barriers, RDD::CommandBufferID &r_command_buffer, CommandBufferPool &r_command_buffer_pool);
+	const Statistics &get_statistics() const { return statistics; }
 	static ResourceTracker *resource_tracker_create();
 	static void resource_tracker_free(ResourceTracker *p_tracker);
 	static FramebufferCache *framebuffer_cache_create();
@@ -556,6 +556,7 @@ enum ViewportRenderInfo {
 	VIEWPORT_RENDER_INFO_OBJECTS_IN_FRAME,
 	VIEWPORT_RENDER_INFO_PRIMITIVES_IN_FRAME,
 	VIEWPORT_RENDER_INFO_DRAW_CALLS_IN_FRAME,
+	VIEWPORT_RENDER_INFO_INSTANCED_OBJECTS_IN_FRAME,
 	VIEWPORT_RENDER_INFO_MAX,
 };
 
@@ -919,6 +920,9 @@ enum RenderingInfo {
 	RENDERING_INFO_PIPELINE_COMPILATIONS_SURFACE,
 	RENDERING_INFO_PIPELINE_COMPILATIONS_DRAW,
 	RENDERING_INFO_PIPELINE_COMPILATIONS_SPECIALIZATION,
+	RENDERING_INFO_PIPELINE_COMPILATIONS_IN_PROGRESS,
+	RENDERING_INFO_PIPELINE_COMPILATION_STALLS,
+	RENDERING_INFO_PIPELINE_COMPILATION_TIME_USEC,
 	RENDERING_INFO_MAX,
 };
 
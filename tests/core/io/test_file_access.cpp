@@ -32,8 +32,10 @@
 
 TEST_FORCE_LINK(test_file_access)
 
+#include "core/io/compression.h"
 #include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/object/worker_thread_pool.h"
 #include "tests/test_utils.h"
 
 namespace TestFileAccess {
@@ -297,4 +299,150 @@ TEST_CASE("[FileAccess] Cursor positioning") {
 	}
 }
 
+TEST_CASE("[FileAccess] Mapped data") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	const Vector<uint8_t> contents = f->get_buffer(f->get_length());
+	const Span<uint8_t> mapped = f->get_mapped_data();
+
+#ifdef UNIX_ENABLED
+	REQUIRE_MESSAGE(!mapped.is_empty(), "Files opened for reading must be mapped on Unix.");
+#endif
+	// Not every platform backend supports mapping files; an empty view is valid there.
+	if (!mapped.is_empty()) {
+		CHECK(mapped.size() == (uint64_t)contents.size());
+		CHECK(memcmp(mapped.ptr(), contents.ptr(), contents.size()) == 0);
+	}
+
+	Ref<FileAccess> fw = FileAccess::open(TestUtils::get_data_path("mapped_data_new.bin"), FileAccess::WRITE);
+	REQUIRE(fw.is_valid());
+	CHECK_MESSAGE(fw->get_mapped_data().is_empty(), "Files opened for writing must not be mapped.");
+	fw->close();
+
+	DirAccess::remove_file_or_error(TestUtils::get_data_path("mapped_data_new.bin"));
+}
+
+TEST_CASE("[FileAccess] Compressed file spanning many blocks") {
+	const String file_path = TestUtils::get_temp_path("compressed_blocks.bin");
+
+	// Large enough for reads to be decompressed in parallel.
+	Vector<uint8_t> data;
+	data.resize(300000);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7) % 251;
+	}
+
+	Ref<FileAccess> fw = FileAccess::open_compressed(file_path, FileAccess::WRITE, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(fw.is_valid());
+	fw->store_buffer(data);
+	fw->close();
+
+	Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(f.is_valid());
+	CHECK(f->get_length() == (uint64_t)data.size());
+
+	SUBCASE("Read whole file") {
+		CHECK(f->get_buffer(data.size()) == data);
+		CHECK(f->get_position() == (uint64_t)data.size());
+	}
+
+	SUBCASE("Read across blocks from an unaligned position") {
+		f->seek(1000);
+		const Vector<uint8_t> read = f->get_buffer(200000);
+		CHECK(read == data.slice(1000, 201000));
+		CHECK(f->get_8() == data[201000]);
+	}
+
+	SUBCASE("Seek within the last block of a parallel read") {
+		const Vector<uint8_t> read = f->get_buffer(17 * 4096);
+		CHECK(read == data.slice(0, 17 * 4096));
+
+		f->seek(16 * 4096 + 5);
+		CHECK(f->get_8() == data[16 * 4096 + 5]);
+	}
+}
+
+TEST_CASE("[FileAccess] Compressed file with a short block") {
+	const String file_path = TestUtils::get_temp_path("compressed_short_block.bin");
+	const uint32_t block_size = 4096;
+	const uint32_t block_count = 24;
+
+	Vector<uint8_t> data;
+	data.resize(block_size * block_count);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7) % 251;
+	}
+
+	// Written by hand, so one block in the middle only holds half its data.
+	LocalVector<Vector<uint8_t>> blocks;
+	for (uint32_t i = 0; i <= block_count; i++) {
+		const uint32_t size = i == block_count ? 0 : (i == 8 ? block_size / 2 : block_size);
+		Vector<uint8_t> block;
+		block.resize(Compression::get_max_compressed_buffer_size(size, Compression::MODE_ZSTD));
+		const int64_t compressed_size = Compression::compress(block.ptrw(), data.ptr() + i * block_size, size, Compression::MODE_ZSTD);
+		REQUIRE(compressed_size > 0);
+		block.resize(compressed_size);
+		blocks.push_back(block);
+	}
+
+	Ref<FileAccess> fw = FileAccess::open(file_path, FileAccess::WRITE);
+	REQUIRE(fw.is_valid());
+	fw->store_buffer((const uint8_t *)"GCPF", 4);
+	fw->store_32(Compression::MODE_ZSTD);
+	fw->store_32(block_size);
+	fw->store_32(data.size());
+	for (const Vector<uint8_t> &block : blocks) {
+		fw->store_32(block.size());
+	}
+	for (const Vector<uint8_t> &block : blocks) {
+		fw->store_buffer(block);
+	}
+	fw->close();
+
+	Ref<FileAccess> f = FileAccess::open_compressed(file_path, FileAccess::READ, FileAccess::COMPRESSION_ZSTD);
+	REQUIRE(f.is_valid());
+	LocalVector<uint8_t> read;
+	read.resize(data.size());
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(f->get_buffer(read.ptr(), read.size()) == uint64_t(-1), "Reading over a block that decompresses short should fail.");
+	ERR_PRINT_ON;
+
+	DirAccess::remove_file_or_error(file_path);
+}
+
+struct ConcurrentMapping {
+	Ref<FileAccess> file;
+	LocalVector<const uint8_t *> ptr;
+	LocalVector<uint64_t> size;
+};
+
+static void _map_task(void *p_userdata, uint32_t p_index) {
+	ConcurrentMapping *mapping = static_cast<ConcurrentMapping *>(p_userdata);
+	const Span<uint8_t> data = mapping->file->get_mapped_data();
+	mapping->ptr[p_index] = data.ptr();
+	mapping->size[p_index] = data.size();
+}
+
+TEST_CASE("[FileAccess] Mapped data from several threads") {
+	Ref<FileAccess> f = FileAccess::open(TestUtils::get_data_path("line_endings_lf.test.txt"), FileAccess::READ);
+	REQUIRE(f.is_valid());
+
+	// The file isn't mapped yet, so the threads race to map it.
+	const uint32_t count = 256;
+	ConcurrentMapping mapping;
+	mapping.file = f;
+	mapping.ptr.resize_initialized(count);
+	mapping.size.resize_initialized(count);
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_map_task, &mapping, count, -1, true, "Concurrent mapping");
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	bool same_mapping = true;
+	for (uint32_t i = 0; i < count; i++) {
+		same_mapping = same_mapping && mapping.ptr[i] == mapping.ptr[0] && mapping.size[i] == mapping.size[0];
+	}
+	CHECK_MESSAGE(same_mapping, "Every thread should see the same mapping.");
+	CHECK(mapping.size[0] == (mapping.ptr[0] ? f->get_length() : 0));
+}
+
 } // namespace TestFileAccess
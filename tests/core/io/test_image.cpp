@@ -34,6 +34,7 @@ TEST_FORCE_LINK(test_image)
 
 #include "core/io/file_access.h"
 #include "core/io/image.h"
+#include "core/object/worker_thread_pool.h"
 #include "tests/test_utils.h"
 
 #include "modules/modules_enabled.gen.h" // For bmp, jpg, svg, webp, tga.
@@ -489,4 +490,95 @@ TEST_CASE("[Image] Convert image") {
 	CHECK_MESSAGE(image2->get_data() == image_data, "Image conversion to invalid type (Image::FORMAT_MAX + 1) should not alter image.");
 }
 
+TEST_CASE("[Image] Processing large images in parallel") {
+	// Large enough to be split in several bands of rows, with an odd height so the
+	// last band of every pass is shorter than the others.
+	const int width = 1024;
+	const int height = 777;
+	Vector<uint8_t> data;
+	data.resize(width * height * 4);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i * 7 + i / 4096) % 256;
+	}
+	Ref<Image> image = Image::create_from_data(width, height, false, Image::FORMAT_RGBA8, data);
+
+	Ref<Image> converted = image->duplicate();
+	converted->convert(Image::FORMAT_RGB8);
+	bool converted_matches = true;
+	for (int i = 0; i < width * height && converted_matches; i++) {
+		converted_matches = memcmp(converted->ptr() + i * 3, data.ptr() + i * 4, 3) == 0;
+	}
+	CHECK_MESSAGE(converted_matches, "Converting a large image should process every row.");
+
+	const int half_width = width / 2;
+	const int half_height = height / 2;
+
+	Ref<Image> resized = image->duplicate();
+	resized->resize(half_width, half_height, Image::INTERPOLATE_NEAREST);
+	bool resized_matches = true;
+	for (int y = 0; y < half_height && resized_matches; y++) {
+		const int src_y = (y + 0.5) * height / half_height;
+		for (int x = 0; x < half_width && resized_matches; x++) {
+			resized_matches = memcmp(resized->ptr() + (y * half_width + x) * 4, data.ptr() + (src_y * width + x * 2 + 1) * 4, 4) == 0;
+		}
+	}
+	CHECK_MESSAGE(resized_matches, "Resizing a large image should process every row.");
+
+	Ref<Image> mipmapped = image->duplicate();
+	mipmapped->generate_mipmaps();
+	REQUIRE(mipmapped->get_mipmap_offset(2) - mipmapped->get_mipmap_offset(1) == half_width * half_height * 4);
+	const uint8_t *mipmap = mipmapped->ptr() + mipmapped->get_mipmap_offset(1);
+	bool mipmap_matches = true;
+	for (int y = 0; y < half_height && mipmap_matches; y++) {
+		for (int x = 0; x < half_width && mipmap_matches; x++) {
+			for (int c = 0; c < 4; c++) {
+				const int ofs = ((y * 2) * width + x * 2) * 4 + c;
+				const int average = (data[ofs] + data[ofs + 4] + data[ofs + width * 4] + data[ofs + width * 4 + 4] + 2) >> 2;
+				mipmap_matches = mipmap_matches && mipmap[(y * half_width + x) * 4 + c] == average;
+			}
+		}
+	}
+	CHECK_MESSAGE(mipmap_matches, "Generating mipmaps of a large image should process every row.");
+}
+
+static void _count_block_rows(void *p_userdata, uint32_t p_from, uint32_t p_to) {
+	uint32_t *counts = static_cast<uint32_t *>(p_userdata);
+	for (uint32_t i = p_from; i < p_to; i++) {
+		counts[i]++;
+	}
+}
+
+TEST_CASE("[Image] Compressing block rows in parallel") {
+	// Enough blocks to be split in several tasks.
+	const uint32_t block_rows = 1024;
+	LocalVector<uint32_t> counts;
+	counts.resize_initialized(block_rows);
+	Image::compress_block_rows(block_rows, 64, &_count_block_rows, counts.ptr());
+
+	bool all_rows_once = true;
+	for (uint32_t i = 0; i < block_rows; i++) {
+		all_rows_once = all_rows_once && counts[i] == 1;
+	}
+	CHECK_MESSAGE(all_rows_once, "Every block row should be compressed exactly once.");
+}
+
+static void _compress_block_rows_task(void *p_userdata) {
+	Image::compress_block_rows(1024, 64, &_count_block_rows, p_userdata);
+}
+
+TEST_CASE("[Image] Compressing block rows from a pool thread") {
+	// Images are compressed from import tasks, those must not wait on the pool themselves.
+	const uint32_t block_rows = 1024;
+	LocalVector<uint32_t> counts;
+	counts.resize_initialized(block_rows);
+	WorkerThreadPool::TaskID task = WorkerThreadPool::get_singleton()->add_native_task(&_compress_block_rows_task, counts.ptr(), false, "Compress block rows");
+	CHECK(WorkerThreadPool::get_singleton()->wait_for_task_completion(task) == OK);
+
+	bool all_rows_once = true;
+	for (uint32_t i = 0; i < block_rows; i++) {
+		all_rows_once = all_rows_once && counts[i] == 1;
+	}
+	CHECK_MESSAGE(all_rows_once, "Every block row should be compressed exactly once.");
+}
+
 } // namespace TestImage
@@ -32,7 +32,9 @@
 
 TEST_FORCE_LINK(test_pck_packer)
 
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/io/pck_packer.h"
 #include "core/os/os.h"
 #include "tests/test_utils.h"
@@ -120,4 +122,222 @@ TEST_CASE("[PCKPacker] Pack a PCK file with some files and directories") {
 			"The generated non-empty PCK file shouldn't be too large.");
 }
 
+TEST_CASE("[PCKPacker] Pack a PCK file with compressed files") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_compressed.pck");
+	CHECK_MESSAGE(
+			pck_packer.pck_start(output_pck_path) == OK,
+			"Starting a PCK file should return an OK error code.");
+
+	Vector<uint8_t> data;
+	data.resize(256 * 1024);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = (i / 1000) % 256;
+	}
+	ERR_PRINT_OFF;
+	pck_packer.set_file_compression(true, FileAccess::COMPRESSION_BROTLI);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			pck_packer.add_file_from_buffer("uncompressed.bin", data) == OK,
+			"Brotli can't compress, so files should still be stored uncompressed after requesting it.");
+	pck_packer.set_file_compression(true);
+	CHECK_MESSAGE(
+			pck_packer.add_file_from_buffer("compressed.bin", data) == OK,
+			"Adding a compressed file to the PCK should return an OK error code.");
+	CHECK_MESSAGE(
+			pck_packer.flush() == OK,
+			"Flushing the PCK should return an OK error code.");
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ, &err);
+	CHECK_MESSAGE(
+			err == OK,
+			"The generated compressed PCK file should be opened successfully.");
+	CHECK_MESSAGE(
+			f->get_length() <= 256 * 1024 + 16000,
+			"The compressed file should take much less space in the PCK than the uncompressed one.");
+	f.unref();
+
+	// Both files read back the same, from the start and from the middle of a block.
+	PackedData *global_packed_data = PackedData::get_singleton();
+	PackedData *packed_data = memnew(PackedData);
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+	for (const String &path : Vector<String>{ "res://uncompressed.bin", "res://compressed.bin" }) {
+		f = packed_data->try_open_path(path);
+		REQUIRE(f.is_valid());
+		CHECK(f->get_length() == (uint64_t)data.size());
+		CHECK(packed_data->get_size(path) == data.size());
+		CHECK(f->get_buffer(data.size()) == data);
+
+		f->seek(100000);
+		Vector<uint8_t> tail = f->get_buffer(data.size());
+		REQUIRE(tail.size() == data.size() - 100000);
+		CHECK(memcmp(tail.ptr(), data.ptr() + 100000, tail.size()) == 0);
+	}
+
+	f.unref();
+	memdelete(packed_data);
+	TestPackedDataInternalsAccessor::singleton() = global_packed_data;
+}
+
+TEST_CASE("[PCKPacker] Pack a PCK file with duplicate files") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_duplicates.pck");
+	CHECK_MESSAGE(
+			pck_packer.pck_start(output_pck_path) == OK,
+			"Starting a PCK file should return an OK error code.");
+
+	Vector<uint8_t> data;
+	data.resize(64 * 1024);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = i * 7 % 251;
+	}
+	for (int i = 0; i < 4; i++) {
+		CHECK_MESSAGE(
+				pck_packer.add_file_from_buffer(vformat("copies/%d.bin", i), data) == OK,
+				"Adding a duplicate file to the PCK should return an OK error code.");
+	}
+	CHECK_MESSAGE(
+			pck_packer.flush() == OK,
+			"Flushing the PCK should return an OK error code.");
+
+	Error err;
+	Ref<FileAccess> f = FileAccess::open(output_pck_path, FileAccess::READ, &err);
+	CHECK_MESSAGE(
+			err == OK,
+			"The generated PCK file should be opened successfully.");
+	CHECK_MESSAGE(
+			f->get_length() < 2 * 64 * 1024,
+			"The generated PCK file should only hold one copy of the duplicated content.");
+}
+
+TEST_CASE("[PCKPacker] Load a PCK file through its path index") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_index.pck");
+	CHECK_MESSAGE(
+			pck_packer.pck_start(output_pck_path) == OK,
+			"Starting a PCK file should return an OK error code.");
+	// Not added in path order, so the index has to sort them.
+	CHECK(pck_packer.add_file_from_buffer("index/b.txt", String("B").to_utf8_buffer()) == OK);
+	CHECK(pck_packer.add_file_from_buffer("index/sub/c.txt", String("C").to_utf8_buffer()) == OK);
+	CHECK(pck_packer.add_file_from_buffer("index/a.txt", String("A").to_utf8_buffer()) == OK);
+	CHECK(pck_packer.add_file_from_buffer("index.txt", String("I").to_utf8_buffer()) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	PackedData *global_packed_data = PackedData::get_singleton();
+	PackedData *packed_data = memnew(PackedData);
+	CHECK_MESSAGE(
+			packed_data->add_pack(output_pck_path, false, 0) == OK,
+			"Loading the generated PCK file should return an OK error code.");
+
+	CHECK(packed_data->has_path("res://index/sub/c.txt"));
+	CHECK(packed_data->has_path("index/../index.txt"));
+	CHECK_FALSE(packed_data->has_path("res://index/d.txt"));
+	CHECK(packed_data->get_file_hash("res://index/sub/c.txt").size() == 16);
+	CHECK(packed_data->get_file_hash("res://index/d.txt").is_empty());
+	CHECK(packed_data->get_size("res://index/a.txt") == 1);
+
+	Ref<FileAccess> f = packed_data->try_open_path("res://index/a.txt");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_as_text() == "A");
+
+	Ref<DirAccess> da = packed_data->try_open_directory("res://index");
+	REQUIRE(da.is_valid());
+	Vector<String> dirs;
+	Vector<String> files;
+	da->list_dir_begin();
+	for (String name = da->get_next(); !name.is_empty(); name = da->get_next()) {
+		if (da->current_is_dir()) {
+			dirs.push_back(name);
+		} else {
+			files.push_back(name);
+		}
+	}
+	da->list_dir_end();
+	files.sort();
+	CHECK(dirs == Vector<String>{ "sub" });
+	CHECK(files == Vector<String>{ "a.txt", "b.txt" });
+
+	CHECK(da->change_dir("sub") == OK);
+	CHECK(da->get_current_dir() == "res://index/sub");
+	CHECK(da->file_exists("c.txt"));
+	CHECK(da->change_dir("..") == OK);
+	CHECK(da->get_current_dir() == "res://index");
+	CHECK(packed_data->try_open_directory("res://index/missing").is_null());
+
+	packed_data->remove_path("res://index/b.txt");
+	CHECK_FALSE(packed_data->has_path("res://index/b.txt"));
+
+	// A later pack overriding an indexed file lists it once.
+	const String override_pck_path = TestUtils::get_temp_path("output_index_override.pck");
+	PCKPacker override_packer;
+	CHECK(override_packer.pck_start(override_pck_path) == OK);
+	CHECK(override_packer.add_file_from_buffer("index/a.txt", String("A2").to_utf8_buffer()) == OK);
+	CHECK(override_packer.flush() == OK);
+	CHECK(packed_data->add_pack(override_pck_path, true, 0) == OK);
+
+	f = packed_data->try_open_path("res://index/a.txt");
+	REQUIRE(f.is_valid());
+	CHECK(f->get_as_text() == "A2");
+
+	files.clear();
+	da = packed_data->try_open_directory("res://index");
+	REQUIRE(da.is_valid());
+	da->list_dir_begin();
+	for (String name = da->get_next(); !name.is_empty(); name = da->get_next()) {
+		if (!da->current_is_dir()) {
+			files.push_back(name);
+		}
+	}
+	da->list_dir_end();
+	CHECK(files == Vector<String>{ "a.txt" });
+
+	f.unref();
+	da.unref();
+	memdelete(packed_data);
+	TestPackedDataInternalsAccessor::singleton() = global_packed_data;
+}
+
+TEST_CASE("[PCKPacker] Mapped data of packed files") {
+	PCKPacker pck_packer;
+	const String output_pck_path = TestUtils::get_temp_path("output_mapped.pck");
+	CHECK(pck_packer.pck_start(output_pck_path) == OK);
+
+	Vector<uint8_t> data;
+	data.resize(4096);
+	for (int i = 0; i < data.size(); i++) {
+		data.write[i] = i * 13 % 256;
+	}
+	CHECK(pck_packer.add_file_from_buffer("mapped/data.bin", data) == OK);
+	CHECK(pck_packer.add_file_from_buffer("mapped/text.txt", String("Mapped").to_utf8_buffer()) == OK);
+	CHECK(pck_packer.flush() == OK);
+
+	PackedData *global_packed_data = PackedData::get_singleton();
+	PackedData *packed_data = memnew(PackedData);
+	REQUIRE(packed_data->add_pack(output_pck_path, false, 0) == OK);
+
+	Ref<FileAccess> f = packed_data->try_open_path("res://mapped/data.bin");
+	REQUIRE(f.is_valid());
+	const Span<uint8_t> mapped = f->get_mapped_data();
+#ifdef UNIX_ENABLED
+	REQUIRE_MESSAGE(!mapped.is_empty(), "Files inside a pack must be mapped on Unix.");
+#endif
+	if (!mapped.is_empty()) {
+		// The view is a slice of the pack, it outlives the file until the packs are cleared.
+		f.unref();
+		REQUIRE(mapped.size() == (uint64_t)data.size());
+		CHECK(memcmp(mapped.ptr(), data.ptr(), data.size()) == 0);
+
+		f = packed_data->try_open_path("res://mapped/text.txt");
+		REQUIRE(f.is_valid());
+		const Span<uint8_t> text = f->get_mapped_data();
+		REQUIRE(text.size() == 6);
+		CHECK(memcmp(text.ptr(), "Mapped", 6) == 0);
+	}
+
+	f.unref();
+	memdelete(packed_data);
+	TestPackedDataInternalsAccessor::singleton() = global_packed_data;
+}
+
 } // namespace TestPCKPacker
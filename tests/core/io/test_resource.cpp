@@ -33,6 +33,7 @@
 TEST_FORCE_LINK(test_resource)
 
 #include "core/io/resource.h"
+#include "core/io/resource_format_binary.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
 #include "core/object/class_db.h"
@@ -628,4 +629,81 @@ TEST_CASE("[Resource] Breaking circular references on save") {
 	resource_c->remove_meta("next");
 }
 
+TEST_CASE("[Resource] Loading binary resources with sub-threads") {
+	Ref<Resource> resource = memnew(Resource);
+	resource->set_name("Root");
+	for (int i = 0; i < 8; i++) {
+		Ref<Resource> child_resource = memnew(Resource);
+		child_resource->set_name(vformat("Child %d", i));
+		PackedInt32Array values;
+		for (int j = 0; j < 100; j++) {
+			values.push_back(i * j);
+		}
+		child_resource->set_meta("values", values);
+		child_resource->set_meta("nested", Dictionary{ { "index", i }, { "list", Array{ i, String::num_int64(i), Vector3(i, 0, 1) } } });
+		resource->set_meta(vformat("child_%d", i), child_resource);
+	}
+	const String save_path = TestUtils::get_temp_path("resource_sub_threads.res");
+	REQUIRE(ResourceSaver::save(resource, save_path) == OK);
+
+	Ref<Resource> sequential = ResourceLoader::load(save_path, "", ResourceFormatLoader::CACHE_MODE_IGNORE);
+	REQUIRE(sequential.is_valid());
+
+	// Compares everything with the resource loaded in order.
+	auto check_same_as_sequential = [&](const Ref<Resource> &p_loaded) {
+		REQUIRE(p_loaded.is_valid());
+		CHECK(p_loaded->get_name() == sequential->get_name());
+		for (int i = 0; i < 8; i++) {
+			const String key = vformat("child_%d", i);
+			Ref<Resource> sequential_child = sequential->get_meta(key);
+			Ref<Resource> loaded_child = p_loaded->get_meta(key);
+			REQUIRE(loaded_child.is_valid());
+			CHECK(loaded_child != sequential_child);
+			CHECK(loaded_child->get_name() == sequential_child->get_name());
+			CHECK(loaded_child->get_meta("values") == sequential_child->get_meta("values"));
+			CHECK(loaded_child->get_meta("nested") == sequential_child->get_meta("nested"));
+		}
+	};
+
+	Ref<ResourceFormatLoaderBinary> loader;
+	loader.instantiate();
+
+	SUBCASE("Decoding on worker threads gives the same result as in order") {
+		Error err = FAILED;
+		Ref<Resource> parallel = loader->load(save_path, save_path, &err, true, nullptr, ResourceFormatLoader::CACHE_MODE_IGNORE);
+		CHECK(err == OK);
+		check_same_as_sequential(parallel);
+	}
+
+	SUBCASE("Several threaded loads with sub-threads complete") {
+		// Loads run on pool threads, where waiting for more pool work could deadlock.
+		LocalVector<String> paths;
+		for (int i = 0; i < 4; i++) {
+			paths.push_back(TestUtils::get_temp_path(vformat("resource_sub_threads_%d.res", i)));
+			REQUIRE(ResourceSaver::save(resource, paths[i]) == OK);
+		}
+		for (const String &path : paths) {
+			REQUIRE(ResourceLoader::load_threaded_request(path, "", true, ResourceFormatLoader::CACHE_MODE_IGNORE) == OK);
+		}
+		for (const String &path : paths) {
+			check_same_as_sequential(ResourceLoader::load_threaded_get(path));
+		}
+	}
+
+	SUBCASE("Internal resources still in the cache are reused as they are") {
+		Ref<Resource> cached = ResourceLoader::load(save_path);
+		REQUIRE(cached.is_valid());
+		Ref<Resource> cached_child = cached->get_meta("child_3");
+		cached.unref();
+
+		Ref<Resource> reloaded = loader->load(save_path, save_path, nullptr, true);
+		REQUIRE(reloaded.is_valid());
+		CHECK(Ref<Resource>(reloaded->get_meta("child_3")) == cached_child);
+		Ref<Resource> reloaded_child = reloaded->get_meta("child_4");
+		REQUIRE(reloaded_child.is_valid());
+		CHECK(reloaded_child->get_name() == "Child 4");
+		CHECK(PackedInt32Array(reloaded_child->get_meta("values")).size() == 100);
+	}
+}
+
 } // namespace TestResource
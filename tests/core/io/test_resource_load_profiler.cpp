@@ -0,0 +1,99 @@
+/**************************************************************************/
+/*  test_resource_load_profiler.cpp                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_resource_load_profiler)
+
+#include "core/io/json.h"
+#include "core/io/resource_load_profiler.h"
+#include "core/os/os.h"
+
+namespace TestResourceLoadProfiler {
+
+// Records a.tres loading b.tres and c.tres, then an unrelated d.tres.
+// b.tres is the slow one, so the critical path is a.tres -> b.tres.
+static void record_loads() {
+	ResourceLoadProfiler::start(String());
+	ResourceLoadProfiler::begin_load("res://a.tres", "Resource");
+	OS::get_singleton()->delay_usec(1000);
+	ResourceLoadProfiler::begin_load("res://b.tres", "");
+	OS::get_singleton()->delay_usec(20000);
+	ResourceLoadProfiler::end_load(OK);
+	ResourceLoadProfiler::begin_load("res://c.tres", "");
+	ResourceLoadProfiler::end_load(ERR_FILE_CORRUPT);
+	ResourceLoadProfiler::end_load(OK);
+	ResourceLoadProfiler::begin_load("res://d.tres", "");
+	ResourceLoadProfiler::end_load(OK);
+}
+
+TEST_CASE("[ResourceLoadProfiler] Critical path") {
+	record_loads();
+
+	uint64_t usec = 0;
+	const LocalVector<String> path = ResourceLoadProfiler::get_critical_path(&usec);
+	REQUIRE(path.size() == 2);
+	CHECK(path[0] == "res://a.tres");
+	CHECK(path[1] == "res://b.tres");
+	CHECK(usec >= 21000);
+
+	ResourceLoadProfiler::stop();
+	CHECK(ResourceLoadProfiler::get_critical_path().is_empty());
+}
+
+TEST_CASE("[ResourceLoadProfiler] Chrome trace") {
+	record_loads();
+
+	Dictionary trace = JSON::parse_string(ResourceLoadProfiler::get_chrome_trace());
+	Array events = trace["traceEvents"];
+	REQUIRE(events.size() == 4);
+
+	// Loads are recorded as they finish, so dependencies come first.
+	Dictionary b = events[0];
+	Dictionary c = events[1];
+	Dictionary a = events[2];
+	CHECK(String(b["name"]) == "res://b.tres");
+	CHECK(String(b["ph"]) == "X");
+	CHECK(int64_t(b["dur"]) >= 20000);
+	CHECK(String(Dictionary(c["args"])["error"]) == String(error_names[ERR_FILE_CORRUPT]));
+
+	CHECK(String(a["name"]) == "res://a.tres");
+	Dictionary a_args = a["args"];
+	CHECK(String(a_args["type_hint"]) == "Resource");
+	CHECK(int64_t(a_args["self_usec"]) < int64_t(a["dur"]));
+	Array dependencies = a_args["dependencies"];
+	REQUIRE(dependencies.size() == 2);
+	CHECK(String(dependencies[0]) == "res://b.tres");
+	CHECK(String(dependencies[1]) == "res://c.tres");
+
+	ResourceLoadProfiler::stop();
+}
+
+} // namespace TestResourceLoadProfiler
@@ -0,0 +1,138 @@
+/**************************************************************************/
+/*  test_compressed_texture.cpp                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_compressed_texture)
+
+#include "core/config/project_settings.h"
+#include "core/io/file_access.h"
+#include "core/io/image.h"
+#include "scene/resources/compressed_texture.h"
+#include "scene/resources/texture_streamer.h"
+#include "tests/test_utils.h"
+
+namespace TestCompressedTexture {
+
+static String _save_ctex(const String &p_name, const Ref<Image> &p_image) {
+	const String path = TestUtils::get_temp_path(p_name);
+	Ref<FileAccess> f = FileAccess::open(path, FileAccess::WRITE);
+	f->store_buffer((const uint8_t *)"GST2", 4);
+	f->store_32(CompressedTexture2D::FORMAT_VERSION);
+	f->store_32(p_image->get_width());
+	f->store_32(p_image->get_height());
+	f->store_32(p_image->has_mipmaps() ? CompressedTexture2D::FORMAT_BIT_HAS_MIPMAPS : 0);
+	f->store_32(0); // Mipmap limit.
+	f->store_32(0);
+	f->store_32(0);
+	f->store_32(0);
+
+	f->store_32(CompressedTexture2D::DATA_FORMAT_IMAGE);
+	f->store_16(p_image->get_width());
+	f->store_16(p_image->get_height());
+	f->store_32(p_image->get_mipmap_count());
+	f->store_32(p_image->get_format());
+	f->store_buffer(p_image->get_data());
+	return path;
+}
+
+TEST_CASE("[SceneTree][CompressedTexture2D] Streaming") {
+	Ref<Image> image = memnew(Image(256, 128, false, Image::FORMAT_RGBA8));
+	image->generate_mipmaps();
+	const String path = _save_ctex("streamed.ctex", image);
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/initial_size", 64);
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/max_loads_per_frame", 4);
+
+	SUBCASE("Reduced detail is loaded first") {
+		ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/memory_budget_mb", 0);
+
+		Ref<CompressedTexture2D> texture;
+		texture.instantiate();
+		REQUIRE(texture->load(path) == OK);
+		CHECK(texture->get_width() == 256);
+		CHECK(texture->get_height() == 128);
+		CHECK(texture->get_image()->get_width() == 64);
+		CHECK(texture->get_image()->get_height() == 32);
+		CHECK(texture->get_image()->has_mipmaps());
+		CHECK(TextureStreamer::get_pending_count() == 1);
+
+		TextureStreamer::flush();
+		CHECK(TextureStreamer::get_pending_count() == 0);
+		CHECK(texture->get_image()->get_width() == 256);
+		CHECK(texture->get_image()->get_height() == 128);
+		CHECK(TextureStreamer::get_resident_size() > 0);
+
+		texture.unref();
+		CHECK(TextureStreamer::get_resident_size() == 0);
+	}
+
+	SUBCASE("Reloading while streaming releases the earlier reservation") {
+		ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/memory_budget_mb", 0);
+
+		Ref<CompressedTexture2D> texture;
+		texture.instantiate();
+		REQUIRE(texture->load(path) == OK);
+		TextureStreamer::process(); // Starts loading the full detail.
+		REQUIRE(texture->load(path) == OK);
+
+		TextureStreamer::flush();
+		CHECK(TextureStreamer::get_pending_count() == 0);
+		CHECK(texture->get_image()->get_width() == 256);
+
+		texture.unref();
+		CHECK(TextureStreamer::get_resident_size() == 0);
+	}
+
+	SUBCASE("Textures over the memory budget keep reduced detail") {
+		ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/memory_budget_mb", 1);
+
+		Ref<Image> large_image = memnew(Image(1024, 1024, false, Image::FORMAT_RGBA8));
+		large_image->generate_mipmaps();
+		const String large_path = _save_ctex("streamed_large.ctex", large_image);
+
+		Ref<CompressedTexture2D> texture;
+		texture.instantiate();
+		REQUIRE(texture->load(large_path) == OK);
+
+		TextureStreamer::flush();
+		CHECK(texture->get_image()->get_width() == 64);
+		CHECK(TextureStreamer::get_pending_count() == 1);
+
+		texture.unref();
+		CHECK(TextureStreamer::get_pending_count() == 0);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("rendering/textures/streaming/enabled", false);
+	TextureStreamer::clear();
+}
+
+} // namespace TestCompressedTexture
@@ -34,11 +34,13 @@ TEST_FORCE_LINK(test_node)
 
 #include "core/io/file_access.h"
 #include "core/io/resource_saver.h"
+#include "core/object/callable_mp.h"
 #include "core/object/class_db.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
 #include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
+#include "tests/signal_watcher.h"
 #include "tests/test_utils.h"
 
 namespace TestNode {
@@ -439,6 +441,48 @@ TEST_CASE("[SceneTree][Node] Testing node operations with a more complex simple
 		CHECK_EQ(E, node1_1);
 	}
 
+	SUBCASE("Groups should stay in tree order as nodes are added, removed and moved") {
+		// Add grouped nodes in an order different from the tree order.
+		LocalVector<Node *> children;
+		for (int i = 0; i < 64; i++) {
+			Node *child = memnew(Node);
+			children.push_back(child);
+			node2->add_child(child);
+		}
+		for (int i = 63; i >= 0; i -= 2) {
+			children[i]->add_to_group("ordered");
+		}
+		for (int i = 0; i < 64; i += 2) {
+			children[i]->add_to_group("ordered");
+		}
+		node1_1->add_to_group("ordered");
+
+		Vector<Node *> nodes = SceneTree::get_singleton()->get_nodes_in_group("ordered");
+		REQUIRE_EQ(nodes.size(), 65);
+		CHECK_EQ(nodes[0], node1_1);
+		bool in_order = true;
+		for (int i = 0; i < 64; i++) {
+			in_order = in_order && nodes[i + 1] == children[i];
+		}
+		CHECK(in_order);
+
+		// Moving a node reorders its groups.
+		node2->move_child(children[0], 63);
+		children[0]->remove_from_group("ordered");
+		children[0]->add_to_group("ordered");
+		nodes = SceneTree::get_singleton()->get_nodes_in_group("ordered");
+		REQUIRE_EQ(nodes.size(), 65);
+		CHECK_EQ(nodes[64], children[0]);
+		CHECK_EQ(nodes[1], children[1]);
+
+		for (int i = 0; i < 64; i++) {
+			memdelete(children[i]);
+		}
+		nodes = SceneTree::get_singleton()->get_nodes_in_group("ordered");
+		REQUIRE_EQ(nodes.size(), 1);
+		CHECK_EQ(nodes[0], node1_1);
+	}
+
 	SUBCASE("Nodes added as siblings of another node should be right next to it") {
 		node1->remove_child(node1_1);
 
@@ -918,4 +962,292 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Resolving node paths repeatedly") {
+	Node *root = memnew(Node);
+	Node *middle = memnew(Node);
+	Node *leaf = memnew(Node);
+	root->set_name("Root");
+	middle->set_name("Middle");
+	leaf->set_name("Leaf");
+	root->add_child(middle);
+	middle->add_child(leaf);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	const NodePath path = NodePath("Middle/Leaf");
+	CHECK(root->get_node_or_null(path) == leaf);
+
+	SUBCASE("Repeated lookups hit the cache") {
+		const uint64_t hits = Node::get_node_path_cache_hits();
+		CHECK(root->get_node_or_null(path) == leaf);
+		CHECK(root->get_node_or_null(NodePath("Middle/Leaf")) == leaf);
+		CHECK(Node::get_node_path_cache_hits() == hits + 2);
+	}
+
+	SUBCASE("Changes outside the branch keep cached paths") {
+		Node *unrelated = memnew(Node);
+		SceneTree::get_singleton()->get_root()->add_child(unrelated);
+		unrelated->set_name("Unrelated");
+		memdelete(unrelated);
+
+		const uint64_t hits = Node::get_node_path_cache_hits();
+		CHECK(root->get_node_or_null(path) == leaf);
+		CHECK(Node::get_node_path_cache_hits() == hits + 1);
+
+		// Paths going up depend on the whole tree.
+		const NodePath up = NodePath("../../Middle");
+		CHECK(leaf->get_node_or_null(up) == middle);
+		Node *sibling = memnew(Node);
+		SceneTree::get_singleton()->get_root()->add_child(sibling);
+		const uint64_t misses = Node::get_node_path_cache_misses();
+		CHECK(leaf->get_node_or_null(up) == middle);
+		CHECK(Node::get_node_path_cache_misses() == misses + 1);
+		memdelete(sibling);
+	}
+
+	SUBCASE("Renaming invalidates cached paths") {
+		leaf->set_name("Renamed");
+		CHECK(root->get_node_or_null(path) == nullptr);
+		CHECK(root->get_node_or_null(NodePath("Middle/Renamed")) == leaf);
+
+		middle->set_name("Other");
+		CHECK(root->get_node_or_null(NodePath("Middle/Renamed")) == nullptr);
+		CHECK(root->get_node_or_null(NodePath("Other/Renamed")) == leaf);
+	}
+
+	SUBCASE("Moving and removing nodes invalidates cached paths") {
+		Node *other = memnew(Node);
+		other->set_name("Other");
+		root->add_child(other);
+		leaf->reparent(other);
+		CHECK(root->get_node_or_null(path) == nullptr);
+		CHECK(root->get_node_or_null(NodePath("Other/Leaf")) == leaf);
+
+		Node *replacement = memnew(Node);
+		replacement->set_name("Leaf");
+		middle->add_child(replacement);
+		CHECK(root->get_node_or_null(path) == replacement);
+
+		memdelete(replacement);
+		CHECK(root->get_node_or_null(path) == nullptr);
+
+		// Once detached, paths leaving the branch must not resolve through the old parent.
+		const NodePath up = NodePath("../../Middle");
+		CHECK(leaf->get_node_or_null(up) == middle);
+		other->remove_child(leaf);
+		CHECK(leaf->get_node_or_null(up) == nullptr);
+		memdelete(leaf);
+	}
+
+	SUBCASE("Unique names follow their owner") {
+		middle->set_owner(root);
+		leaf->set_owner(root);
+		leaf->set_unique_name_in_owner(true);
+		CHECK(middle->get_node_or_null(NodePath("%Leaf/..")) == middle);
+		leaf->set_unique_name_in_owner(false);
+		CHECK(middle->get_node_or_null(NodePath("%Leaf/..")) == nullptr);
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node] Adding and removing large branches") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *before = memnew(Node);
+	before->add_to_group("streamed");
+	before->set_process(true);
+	tree->get_root()->add_child(before);
+
+	Node *branch = memnew(Node);
+	for (int i = 0; i < 64; i++) {
+		Node *child = memnew(Node);
+		child->add_to_group("streamed");
+		child->set_process(true);
+		child->set_physics_process(true);
+		branch->add_child(child);
+		Node *grandchild = memnew(Node);
+		grandchild->add_to_group("streamed");
+		grandchild->set_process(true);
+		child->add_child(grandchild);
+	}
+
+	tree->get_root()->add_child(branch);
+	CHECK(tree->get_node_count_in_group("streamed") == 129);
+	Vector<Node *> streamed = tree->get_nodes_in_group("streamed");
+	CHECK(streamed[0] == before);
+	CHECK(streamed[1] == branch->get_child(0));
+	CHECK(streamed[2] == branch->get_child(0)->get_child(0));
+	CHECK(streamed[128] == branch->get_child(63)->get_child(0));
+
+	SIGNAL_WATCH(tree, "tree_changed");
+	tree->get_root()->remove_child(branch);
+	Array one_emission = { {} };
+	SIGNAL_CHECK("tree_changed", one_emission); // Once for the whole branch, not once per node.
+	SIGNAL_UNWATCH(tree, "tree_changed");
+
+	streamed = tree->get_nodes_in_group("streamed");
+	REQUIRE(streamed.size() == 1);
+	CHECK(streamed[0] == before);
+
+	// Processing still works for what is left, and for the branch once added back.
+	tree->process(0);
+	tree->get_root()->add_child(branch);
+	CHECK(tree->get_node_count_in_group("streamed") == 129);
+	tree->process(0);
+	tree->physics_process(0);
+
+	memdelete(branch);
+	CHECK(tree->get_node_count_in_group("streamed") == 1);
+	memdelete(before);
+}
+
+static LocalVector<Node *> attach_ready_order;
+
+static void _attach_ready(Node *p_node) {
+	attach_ready_order.push_back(p_node);
+}
+
+TEST_CASE("[SceneTree][Node] Attaching a branch over several frames") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	// TestNode adds an internal child at the front and one at the back.
+	TestNode *branch = memnew(TestNode);
+	Node *a = memnew(Node);
+	a->set_name("A");
+	branch->add_child(a);
+	Node *a1 = memnew(Node);
+	a1->set_name("A1");
+	a->add_child(a1);
+	a1->set_owner(branch);
+	Node *b = memnew(Node);
+	b->set_name("B");
+	branch->add_child(b);
+	Node *front = branch->get_child(0, true);
+	Node *back = branch->get_child(3, true);
+
+	Node *nodes[] = { branch, front, back, a, a1, b };
+	for (Node *node : nodes) {
+		node->connect(SceneStringName(ready), callable_mp_static(&_attach_ready).bind(node));
+	}
+	attach_ready_order.clear();
+
+	SIGNAL_WATCH(tree, "branch_attached");
+	tree->attach_branch(tree->get_root(), branch, 0.0);
+	CHECK(tree->get_attaching_branch_count() == 1);
+	CHECK_FALSE(branch->is_inside_tree());
+
+	// Without a budget, a single node enters per frame.
+	tree->process(0);
+	CHECK(branch->is_inside_tree());
+	CHECK(branch->get_child_count(true) == 0);
+	CHECK_FALSE(branch->is_ready());
+
+	int frames = 1;
+	while (tree->get_attaching_branch_count() > 0 && frames < 10) {
+		SIGNAL_CHECK_FALSE("branch_attached");
+		CHECK(attach_ready_order.is_empty());
+		tree->process(0);
+		frames++;
+	}
+	CHECK(frames == 6);
+	Array args = { Array{ branch } };
+	SIGNAL_CHECK("branch_attached", args);
+	SIGNAL_UNWATCH(tree, "branch_attached");
+
+	// Same children, positions and owners as before.
+	REQUIRE(branch->get_child_count(true) == 4);
+	CHECK(branch->get_child(0, true) == front);
+	CHECK(branch->get_child(1, true) == a);
+	CHECK(branch->get_child(2, true) == b);
+	CHECK(branch->get_child(3, true) == back);
+	CHECK(branch->get_node(NodePath("A/A1")) == a1);
+	CHECK(a1->get_owner() == branch);
+	CHECK(a1->is_inside_tree());
+
+	// Ready order matches add_child(), children before their parent.
+	REQUIRE(attach_ready_order.size() == 6);
+	CHECK(attach_ready_order[0] == front);
+	CHECK(attach_ready_order[1] == back);
+	CHECK(attach_ready_order[2] == a1);
+	CHECK(attach_ready_order[3] == a);
+	CHECK(attach_ready_order[4] == b);
+	CHECK(attach_ready_order[5] == branch);
+
+	memdelete(branch);
+}
+
+static int attach_children_on_enter = -1;
+static LocalVector<Node *> attach_entered_children;
+
+static void _attach_entered(Node *p_node) {
+	attach_children_on_enter = p_node->get_child_count();
+}
+
+static void _attach_child_entered(Node *p_child) {
+	attach_entered_children.push_back(p_child);
+}
+
+TEST_CASE("[SceneTree][Node] Children of a node being attached are linked after it enters") {
+	SceneTree *tree = SceneTree::get_singleton();
+
+	Node *branch = memnew(Node);
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	branch->add_child(child);
+	branch->connect(SceneStringName(tree_entered), callable_mp_static(&_attach_entered).bind(branch));
+	branch->connect(SNAME("child_entered_tree"), callable_mp_static(&_attach_child_entered));
+
+	SUBCASE("With add_child(), children are already there when the node enters") {
+		attach_children_on_enter = -1;
+		attach_entered_children.clear();
+		tree->get_root()->add_child(branch);
+		CHECK(attach_children_on_enter == 1);
+		REQUIRE(attach_entered_children.size() == 1);
+		CHECK(attach_entered_children[0] == child);
+	}
+
+	SUBCASE("With attach_branch(), children are added back as they enter") {
+		attach_children_on_enter = -1;
+		attach_entered_children.clear();
+		tree->attach_branch(tree->get_root(), branch, 0.0);
+		tree->process(0);
+		CHECK(attach_children_on_enter == 0);
+		CHECK(branch->get_node_or_null(NodePath("Child")) == nullptr);
+		CHECK(attach_entered_children.is_empty());
+
+		tree->process(0);
+		CHECK(tree->get_attaching_branch_count() == 0);
+		CHECK(branch->get_node_or_null(NodePath("Child")) == child);
+		REQUIRE(attach_entered_children.size() == 1);
+		CHECK(attach_entered_children[0] == child);
+	}
+
+	memdelete(branch);
+}
+
+TEST_CASE("[SceneTree][Node] Freeing the parent of a branch being attached") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *parent = memnew(Node);
+	tree->get_root()->add_child(parent);
+
+	Node *branch = memnew(Node);
+	Node *child = memnew(Node);
+	branch->add_child(child);
+	Node *grandchild = memnew(Node);
+	child->add_child(grandchild);
+	ObjectID child_id = child->get_instance_id();
+	ObjectID grandchild_id = grandchild->get_instance_id();
+
+	tree->attach_branch(parent, branch, 0.0);
+	tree->process(0);
+	CHECK(branch->get_parent() == parent);
+	CHECK(branch->get_child_count() == 0);
+
+	// The nodes not attached yet are freed along with the rest.
+	memdelete(parent);
+	tree->process(0);
+	CHECK(tree->get_attaching_branch_count() == 0);
+	CHECK(ObjectDB::get_instance(child_id) == nullptr);
+	CHECK(ObjectDB::get_instance(grandchild_id) == nullptr);
+}
+
 } // namespace TestNode
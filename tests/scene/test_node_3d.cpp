@@ -0,0 +1,208 @@
+/**************************************************************************/
+/*  test_node_3d.cpp                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_node_3d)
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+
+	// Like physics bodies do while syncing their transform from the server.
+	void set_ignoring_notifications(bool p_ignore) { set_ignore_transform_notification(p_ignore); }
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+TEST_CASE("[SceneTree][Node3D] Repeated transform changes on a hierarchy") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node3D *root = memnew(Node3D);
+	Node3D *middle = memnew(Node3D);
+	TransformNotifiedNode3D *leaf = memnew(TransformNotifiedNode3D);
+	root->add_child(middle);
+	middle->add_child(leaf);
+	tree->get_root()->add_child(root);
+	tree->flush_transform_notifications();
+	leaf->transform_changed_count = 0;
+
+	SUBCASE("Global transforms stay correct when ancestors change repeatedly") {
+		root->set_position(Vector3(1, 0, 0));
+		middle->set_position(Vector3(0, 1, 0));
+		root->set_position(Vector3(2, 0, 0));
+		middle->set_position(Vector3(0, 2, 0));
+		leaf->set_position(Vector3(0, 0, 3));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(2, 2, 3)));
+
+		root->set_position(Vector3(5, 0, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(5, 2, 3)));
+		CHECK(middle->get_global_position().is_equal_approx(Vector3(5, 2, 0)));
+	}
+
+	SUBCASE("Transform notifications are queued once per flush") {
+		root->set_position(Vector3(1, 0, 0));
+		middle->set_position(Vector3(0, 1, 0));
+		root->set_position(Vector3(2, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 1);
+
+		// Nothing read the global transform, yet a change after the flush must still notify.
+		root->set_position(Vector3(3, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 1, 0)));
+	}
+
+	SUBCASE("Nodes added below an already changed subtree are notified of later changes") {
+		root->set_position(Vector3(1, 0, 0));
+		TransformNotifiedNode3D *added = memnew(TransformNotifiedNode3D);
+		middle->add_child(added);
+		tree->flush_transform_notifications();
+		added->transform_changed_count = 0;
+		leaf->transform_changed_count = 0;
+
+		root->set_position(Vector3(2, 0, 0));
+		TransformNotifiedNode3D *late = memnew(TransformNotifiedNode3D);
+		middle->add_child(late);
+		late->transform_changed_count = 0;
+		root->set_position(Vector3(3, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(added->transform_changed_count == 1);
+		CHECK(leaf->transform_changed_count == 1);
+		CHECK(late->transform_changed_count == 1);
+		CHECK(late->get_global_position().is_equal_approx(Vector3(3, 0, 0)));
+
+		memdelete(late);
+		memdelete(added);
+	}
+
+	SUBCASE("Nodes changed while ignoring notifications are notified of later changes") {
+		leaf->set_ignoring_notifications(true);
+		leaf->set_position(Vector3(0, 0, 1));
+		leaf->set_ignoring_notifications(false);
+		middle->set_position(Vector3(0, 1, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 1);
+
+		leaf->set_ignoring_notifications(true);
+		middle->set_position(Vector3(0, 2, 0));
+		leaf->set_ignoring_notifications(false);
+		root->set_position(Vector3(1, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(1, 2, 1)));
+	}
+
+	SUBCASE("Forced transform updates do not hide later changes") {
+		root->set_position(Vector3(1, 0, 0));
+		leaf->force_update_transform();
+		CHECK(leaf->transform_changed_count == 1);
+
+		root->set_position(Vector3(2, 0, 0));
+		tree->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 2);
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D] Set a property on many nodes at once") {
+	SceneTree *tree = SceneTree::get_singleton();
+	Node3D *parent = memnew(Node3D);
+	tree->get_root()->add_child(parent);
+
+	PackedInt64Array ids;
+	PackedVector3Array positions;
+	for (int i = 0; i < 8; i++) {
+		Node3D *child = memnew(Node3D);
+		parent->add_child(child);
+		ids.push_back(child->get_instance_id());
+		positions.push_back(Vector3(i, i * 2, i * 3));
+	}
+
+	SUBCASE("Packed values matching the setter type") {
+		CHECK(tree->set_nodes_property(ids, "position", positions) == 8);
+		for (int i = 0; i < 8; i++) {
+			CHECK(Object::cast_to<Node3D>(parent->get_child(i))->get_position() == positions[i]);
+		}
+	}
+
+	SUBCASE("Values converted through Variant") {
+		Array scales;
+		for (int i = 0; i < 8; i++) {
+			scales.push_back(Vector3i(i + 1, 1, 1));
+		}
+		CHECK(tree->set_nodes_property(ids, "scale", scales) == 8);
+		CHECK(Object::cast_to<Node3D>(parent->get_child(3))->get_scale().is_equal_approx(Vector3(4, 1, 1)));
+
+		PackedFloat32Array angles;
+		angles.resize(8);
+		angles.fill(0.5);
+		CHECK(tree->set_nodes_property(ids, "rotation_degrees", angles) == 0); // Floats are not vectors.
+	}
+
+	SUBCASE("Mixed and invalid nodes") {
+		Node *plain = memnew(Node);
+		parent->add_child(plain);
+		PackedInt64Array mixed_ids = ids;
+		mixed_ids.push_back(plain->get_instance_id());
+		PackedVector3Array mixed_positions = positions;
+		mixed_positions.push_back(Vector3(1, 1, 1));
+		CHECK(tree->set_nodes_property(mixed_ids, "position", mixed_positions) == 8);
+
+		ERR_PRINT_OFF;
+		CHECK(tree->set_nodes_property(ids, "position", PackedVector3Array()) == 0);
+		PackedInt64Array stale_ids;
+		stale_ids.push_back(int64_t(ObjectID().operator uint64_t()));
+		CHECK(tree->set_nodes_property(stale_ids, "position", PackedVector3Array({ Vector3() })) == 0);
+		ERR_PRINT_ON;
+	}
+
+	memdelete(parent);
+}
+
+} // namespace TestNode3D
@@ -0,0 +1,80 @@
+/**************************************************************************/
+/*  test_node_profiler.cpp                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_node_profiler)
+
+#include "scene/main/node_profiler.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
+
+namespace TestNodeProfiler {
+
+TEST_CASE("[SceneTree][NodeProfiler] Attribute process time to nodes") {
+	Node *processed = memnew(Node);
+	processed->set_name("Processed");
+	processed->set_process(true);
+	Node *idle = memnew(Node);
+	idle->set_name("Idle");
+	SceneTree::get_singleton()->get_root()->add_child(processed);
+	SceneTree::get_singleton()->get_root()->add_child(idle);
+
+	NodeProfiler::start(10, 1, false);
+	SceneTree::get_singleton()->process(0);
+
+	const Array costs = NodeProfiler::get_top_costs();
+	REQUIRE(costs.size() == 3);
+	CHECK(int64_t(costs[0]) == 1);
+
+	const Array nodes = costs[1];
+	bool processed_found = false;
+	bool idle_found = false;
+	for (int i = 0; i < nodes.size(); i++) {
+		const Array entry = nodes[i];
+		processed_found = processed_found || String(entry[0]) == String(processed->get_path());
+		idle_found = idle_found || String(entry[0]) == String(idle->get_path());
+	}
+	CHECK(processed_found);
+	CHECK_FALSE(idle_found);
+
+	const Array scenes = costs[2];
+	CHECK(scenes.size() >= 1);
+
+	NodeProfiler::stop();
+	CHECK_FALSE(NodeProfiler::is_enabled());
+	SceneTree::get_singleton()->process(0);
+	CHECK(NodeProfiler::get_sampled_frames() == 0);
+
+	memdelete(idle);
+	memdelete(processed);
+}
+
+} // namespace TestNodeProfiler
@@ -33,6 +33,8 @@
 TEST_FORCE_LINK(test_packed_scene)
 
 #include "core/object/callable_mp.h"
+#include "scene/main/scene_tree.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 namespace TestPackedScene {
@@ -216,6 +218,108 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+TEST_CASE("[PackedScene] Instantiate Packed Scene Repeatedly") {
+	// Create a scene to pack.
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_process_priority(5);
+	child->set_editor_description("Spawned");
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	// Pack the scene.
+	PackedScene packed_scene;
+	packed_scene.pack(scene);
+
+	// Later instances replay what the first one resolved, and must get the same properties.
+	for (int i = 0; i < 3; i++) {
+		Node *instance = packed_scene.instantiate();
+		REQUIRE(instance != nullptr);
+		REQUIRE(instance->get_child_count() == 1);
+		CHECK(instance->get_child(0)->get_process_priority() == 5);
+		CHECK(instance->get_child(0)->get_editor_description() == "Spawned");
+		memdelete(instance);
+	}
+
+	// Properties added to the state afterwards must be applied too.
+	Ref<SceneState> state = packed_scene.get_state();
+	state->add_node_property(1, state->add_name("process_physics_priority"), state->add_value(7));
+
+	Node *instance = packed_scene.instantiate();
+	REQUIRE(instance != nullptr);
+	CHECK(instance->get_child(0)->get_process_priority() == 5);
+	CHECK(instance->get_child(0)->get_physics_process_priority() == 7);
+
+	memdelete(scene);
+	memdelete(instance);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Reuse Pooled Instances") {
+	Node *scene = memnew(Node);
+	scene->set_name("TestScene");
+	Node *child = memnew(Node);
+	child->set_name("Child");
+	child->set_process_priority(5);
+	scene->add_child(child);
+	child->set_owner(scene);
+
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	SceneTree *tree = SceneTree::get_singleton();
+	Node *instance = tree->acquire_pooled_instance(packed_scene);
+	REQUIRE(instance != nullptr);
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 0);
+
+	tree->get_root()->add_child(instance);
+	instance->set_process_priority(3);
+	instance->get_child(0)->set_process_priority(7);
+	instance->get_child(0)->set_editor_description("Modified");
+
+	// Released instances leave the tree at the end of the frame.
+	tree->release_pooled_instance(instance);
+	CHECK(instance->is_inside_tree());
+	tree->process(0);
+	CHECK_FALSE(instance->is_inside_tree());
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 1);
+
+	// The same instance is handed out again, as it was right after instantiation.
+	Node *reused = tree->acquire_pooled_instance(packed_scene);
+	CHECK(reused == instance);
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 0);
+	CHECK(reused->get_process_priority() == 0);
+	CHECK(reused->get_child(0)->get_process_priority() == 5);
+	CHECK(reused->get_child(0)->get_editor_description().is_empty());
+
+	Node *other = memnew(Node);
+	ERR_PRINT_OFF;
+	tree->release_pooled_instance(other); // Not acquired from the pool.
+	ERR_PRINT_ON;
+	memdelete(other);
+
+	// Instances freed while waiting to be reused leave the pool.
+	tree->release_pooled_instance(reused);
+	tree->process(0);
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 1);
+	memdelete(reused);
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 0);
+
+	Node *fresh = tree->acquire_pooled_instance(packed_scene);
+	REQUIRE(fresh != nullptr);
+	CHECK(fresh->get_child_count() == 1);
+
+	tree->release_pooled_instance(fresh);
+	tree->process(0);
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 1);
+	tree->clear_instance_pool(packed_scene);
+	CHECK(tree->get_pooled_instance_count(packed_scene) == 0);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
@@ -0,0 +1,125 @@
+/**************************************************************************/
+/*  test_render_forward_clustered.cpp                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "tests/test_macros.h"
+
+TEST_FORCE_LINK(test_render_forward_clustered)
+
+#include "servers/rendering/renderer_rd/forward_clustered/render_forward_clustered.h"
+
+namespace RendererSceneRenderImplementation {
+
+// Builds a sorted render list by hand, without a rendering device.
+class TestRenderForwardClusteredAccessor {
+	using Instance = RenderForwardClustered::GeometryInstanceForwardClustered;
+	using Surface = RenderForwardClustered::GeometryInstanceSurfaceDataCache;
+
+	LocalVector<Instance *> instances;
+	LocalVector<Surface *> elements;
+
+public:
+	Vector<uint32_t> repeats;
+
+	void add(uint32_t p_mesh, uint32_t p_material, bool p_mirror = false, bool p_multimesh = false) {
+		Instance *instance = memnew(Instance);
+		instance->mirror = p_mirror;
+		instance->flags_cache = p_multimesh ? RenderForwardClustered::INSTANCE_DATA_FLAG_MULTIMESH : 0;
+		instances.push_back(instance);
+
+		Surface *surface = memnew(Surface);
+		surface->sort.sort_key1 = 0;
+		surface->sort.sort_key2 = 0;
+		surface->sort.geometry_id = p_mesh;
+		surface->sort.material_id_lo = p_material;
+		surface->owner = instance;
+		elements.push_back(surface);
+	}
+
+	uint32_t fill_repeats() {
+		LocalVector<RenderForwardClustered::RenderElementInfo> element_info;
+		element_info.resize(elements.size());
+		const uint32_t draw_calls = RenderForwardClustered::_fill_element_repeats(elements.ptr(), element_info.ptr(), elements.size());
+		repeats.clear();
+		for (const RenderForwardClustered::RenderElementInfo &info : element_info) {
+			repeats.push_back(info.repeat);
+		}
+		return draw_calls;
+	}
+
+	~TestRenderForwardClusteredAccessor() {
+		for (Surface *surface : elements) {
+			memdelete(surface);
+		}
+		for (Instance *instance : instances) {
+			memdelete(instance);
+		}
+	}
+};
+
+} // namespace RendererSceneRenderImplementation
+
+namespace TestRenderForwardClustered {
+
+using RendererSceneRenderImplementation::TestRenderForwardClusteredAccessor;
+
+TEST_CASE("[RenderForwardClustered] Repeated mesh and material pairs are instanced") {
+	TestRenderForwardClusteredAccessor list;
+	list.add(1, 1);
+	list.add(1, 1);
+	list.add(1, 1);
+	list.add(1, 2);
+	list.add(1, 2);
+	list.add(2, 1);
+
+	const uint32_t draw_calls = list.fill_repeats();
+	CHECK(draw_calls == 3);
+	CHECK_MESSAGE(list.repeats.size() - draw_calls == 3, "Three objects should be drawn as instances of a previous draw call.");
+	CHECK(list.repeats == Vector<uint32_t>{ 3, 2, 1, 2, 1, 1 });
+}
+
+TEST_CASE("[RenderForwardClustered] Mirrored and multimesh elements break instancing") {
+	TestRenderForwardClusteredAccessor list;
+	list.add(1, 1);
+	list.add(1, 1, true);
+	list.add(1, 1, true);
+	list.add(2, 1, false, true);
+	list.add(2, 1, false, true);
+
+	CHECK(list.fill_repeats() == 4);
+	CHECK(list.repeats == Vector<uint32_t>{ 1, 2, 1, 1, 1 });
+}
+
+TEST_CASE("[RenderForwardClustered] Empty render list") {
+	TestRenderForwardClusteredAccessor list;
+	CHECK(list.fill_repeats() == 0);
+	CHECK(list.repeats.is_empty());
+}
+
+} // namespace TestRenderForwardClustered
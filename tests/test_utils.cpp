@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/io/dir_access.h"
+#include "core/io/file_access_pack.h"
 #include "core/os/os.h"
 
 String TestUtils::get_data_path(const String &p_file) {
@@ -52,3 +53,7 @@ String TestUtils::get_temp_path(const String &p_suffix) {
 String &TestProjectSettingsInternalsAccessor::resource_path() {
 	return ProjectSettings::get_singleton()->resource_path;
 }
+
+PackedData *&TestPackedDataInternalsAccessor::singleton() {
+	return PackedData::singleton;
+}
@@ -30,6 +30,7 @@
 
 #pragma once
 
+class PackedData;
 class String;
 
 namespace TestUtils {
@@ -46,3 +47,9 @@ class TestProjectSettingsInternalsAccessor {
 public:
 	static String &resource_path();
 };
+
+// Lets tests put the global instance back after freeing a local one, which took its place.
+class TestPackedDataInternalsAccessor {
+public:
+	static PackedData *&singleton();
+};